@@ -0,0 +1,728 @@
+/**
+ * @file mc1081_bench.c
+ * @brief Bus cost benchmark of the MC1081 driver API.
+ *
+ * Every public API and a few scan workloads run against the software model
+ * through an instrumented bus: handle setup and teardown, the register
+ * getters / setters, the device configuration and scan plan calls, the
+ * asynchronous request path (over a transport that completes at once) and
+ * MC1081_AcquireWhenReady() in both continuous and single-shot mode.
+ * Pure helpers without a handle (encode / decode, MC1081_CalI2cAddr) and the
+ * stage / statistics accessors are not listed. Each line of the output is
+ * one JSON object:
+ *
+ *   {"op":"...","tx":..,"wr_bytes":..,"rd_bytes":..,
+ *    "bus_us_100k":..,"bus_us_400k":..,"bus_us_1m":..,"cpu_ns":..}
+ *
+ * All values are per call. Bus time counts 9 clocks per byte (address byte
+ * included) plus START/STOP. cpu_ns is measured against a bus that only
+ * counts, so it is the cost of the driver itself.
+ *
+ * With --combined the bus also offers MC1081_Bus_t::ReadRegs, as the Linux
+ * i2c-dev backend does: every register read is one transaction with a
+ * repeated start instead of a write and a read.
+ *
+ * Build (from the repository root):
+ *   gcc -O2 -Iinclude bench/mc1081_bench.c src/MC1081.c src/MC1081_sim.c -lm -o mc1081_bench
+ */
+
+#define _POSIX_C_SOURCE 200809L
+
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+#include "MC1081.h"
+#include "MC1081_sim.h"
+
+#define BENCH_CPU_LOOPS (200000UL)
+
+/* ---------------- 计数总线 ---------------- */
+
+typedef struct
+{
+    MC1081_Bus_t inner; /* 被包装的总线, Write 为 NULL 时只计数 */
+    uint64_t tx;
+    uint64_t wr_bytes;
+    uint64_t rd_bytes;
+    uint64_t clocks; /* SCL 时钟数 */
+} BenchBus_t;
+
+static int BenchWrite(void *ctx, uint8_t addr, const uint8_t *data, size_t len)
+{
+    BenchBus_t *b = (BenchBus_t *)ctx;
+    b->tx++;
+    b->wr_bytes += len;
+    b->clocks += (uint64_t)(len + 1) * 9U + 2U;
+    return (b->inner.Write != NULL) ? b->inner.Write(b->inner.ctx, addr, data, len) : 0;
+}
+
+static int BenchRead(void *ctx, uint8_t addr, uint8_t *dst, size_t len)
+{
+    BenchBus_t *b = (BenchBus_t *)ctx;
+    b->tx++;
+    b->rd_bytes += len;
+    b->clocks += (uint64_t)(len + 1) * 9U + 2U;
+    if (b->inner.Read != NULL)
+        return b->inner.Read(b->inner.ctx, addr, dst, len);
+    memset(dst, 0, len);
+    return 0;
+}
+
+/* 组合读: 每段 地址+指针, 重复起始, 地址+数据; 整个列表一个 START/STOP */
+static int BenchReadRegs(void *ctx, uint8_t addr, const MC1081_ScanBurst_t *burst, uint8_t num, uint8_t *dst)
+{
+    BenchBus_t *b = (BenchBus_t *)ctx;
+    b->tx++;
+    b->wr_bytes += num;
+    b->clocks += 2U;
+
+    for (uint8_t i = 0; i < num; i++)
+    {
+        b->rd_bytes += burst[i].len;
+        b->clocks += 2U * 9U + 1U + (uint64_t)(burst[i].len + 1) * 9U;
+
+        if (b->inner.Write != NULL)
+        {
+            if (b->inner.Write(b->inner.ctx, addr, &burst[i].reg, 1) != 0 ||
+                b->inner.Read(b->inner.ctx, addr, dst, burst[i].len) != 0)
+                return -1;
+        }
+        else
+        {
+            memset(dst, 0, burst[i].len);
+        }
+        dst += burst[i].len;
+    }
+
+    return 0;
+}
+
+static void BenchDelay(void *ctx, uint32_t us)
+{
+    BenchBus_t *b = (BenchBus_t *)ctx;
+    if (b->inner.Delay != NULL)
+        b->inner.Delay(b->inner.ctx, us);
+}
+
+/* ---------------- 被测操作 ---------------- */
+
+static uint8_t s_scan_bus = 0; /* --combined 时为 MC1081_SCAN_COMBINED */
+
+typedef void (*BenchOp_t)(MC1081_Handle_t h);
+
+static void OpGetTempRaw(MC1081_Handle_t h)
+{
+    uint16_t v;
+    MC1081_GetTempRaw(h, &v);
+}
+
+static void OpGetSigleCHxRaw(MC1081_Handle_t h)
+{
+    uint16_t v;
+    MC1081_GetSigleCHxRaw(h, MC1081_DCH_SING_3, &v);
+}
+
+static void OpGetMCHxRaw(MC1081_Handle_t h)
+{
+    uint16_t v;
+    MC1081_GetMCHxRaw(h, MC1081_MCH_SING_1, &v);
+}
+
+static void OpGetDiffDCHxRaw(MC1081_Handle_t h)
+{
+    uint16_t v;
+    MC1081_GetDiffDCHxRaw(h, MC1081_DCH_DIFF_1, &v);
+}
+
+static void OpReadSnapshot(MC1081_Handle_t h)
+{
+    MC1081_Snapshot_t s;
+    MC1081_ReadSnapshot(h, &s);
+}
+
+static void OpReadFrame(MC1081_Handle_t h)
+{
+    MC1081_Frame_t f;
+    MC1081_ReadFrame(h, NULL, &f);
+}
+
+static void OpIsSingleChOverflow(MC1081_Handle_t h)
+{
+    (void)MC1081_IsSingleChOverflow(h, MC1081_DCH_SING_3);
+}
+
+static void OpCheckchxOverflow_Diff(MC1081_Handle_t h)
+{
+    (void)MC1081_CheckchxOverflow_Diff(h, MC1081_DCH_DIFF_1);
+}
+
+static void OpIsMChOverflow(MC1081_Handle_t h)
+{
+    (void)MC1081_IsMChOverflow(h, MC1081_MCH_SING_1);
+}
+
+static void OpClearOverflowFlag(MC1081_Handle_t h)
+{
+    MC1081_ClearOverflowFlag(h);
+}
+
+static void OpGetStatus(MC1081_Handle_t h)
+{
+    uint8_t c, t;
+    MC1081_GetStatus(h, &c, &t);
+}
+
+static void OpTempConfig(MC1081_Handle_t h)
+{
+    MC1081_TempConfig(h, MC1081_TEMP_CONV_ON, MC1081_TEMP_TIME_0P3_MS);
+}
+
+static const MC1081_CapConvConfig_t s_cap_cfg = {
+    .osc_mode = MC1081_CAP_OSC_SINGLE,
+    .interval = MC1081_CAP_TIME_CONT,
+    .avg_cycle = MC1081_CAP_AVG_1,
+    .sleep = MC1081_CHIP_SLEEP_OFF,
+    .start = MC1081_CAP_START_PERIODIC,
+};
+
+static void OpCapMeasureSet(MC1081_Handle_t h)
+{
+    MC1081_CapMeasureSet(h, s_cap_cfg);
+}
+
+static void OpCapMeasureGet(MC1081_Handle_t h)
+{
+    MC1081_CapConvConfig_t c;
+    MC1081_CapMeasureGet(h, &c);
+}
+
+static void OpSetFinCycle(MC1081_Handle_t h)
+{
+    MC1081_SetFinCycle(h, 0x40);
+}
+
+static void OpGetFinCycle(MC1081_Handle_t h)
+{
+    uint8_t v;
+    MC1081_GetFinCycle(h, &v);
+}
+
+static const MC1081_ClockCfg_t s_clk_cfg = {
+    .fin_div = MC1081_FINDIV_4,
+    .fref_div = MC1081_FREFDIV_4,
+    .fin_build = MC1081_FIN_BUILD_4_CYCLE,
+};
+
+static void OpSetClockConfig(MC1081_Handle_t h)
+{
+    MC1081_SetClockConfig(h, s_clk_cfg);
+}
+
+static void OpGetClockConfig(MC1081_Handle_t h)
+{
+    MC1081_ClockCfg_t c;
+    MC1081_GetClockConfig(h, &c);
+}
+
+static void OpChSingleEnableSet(MC1081_Handle_t h)
+{
+    MC1081_ChSingleEn_t en = {.value = 0x07FF};
+    MC1081_ChSingleEnableSet(h, en);
+}
+
+static void OpChSingleEnableGet(MC1081_Handle_t h)
+{
+    MC1081_ChSingleEn_t en;
+    MC1081_ChSingleEnableGet(h, &en);
+}
+
+static void OpMchxEnableSet(MC1081_Handle_t h)
+{
+    MC1081_MchEn_t en = {.value = 0x00};
+    MC1081_MchxEnableSet(h, en);
+}
+
+static void OpMchxEnableGet(MC1081_Handle_t h)
+{
+    MC1081_MchEn_t en;
+    MC1081_MchxEnableGet(h, &en);
+}
+
+static void OpSingleOSCSet(MC1081_Handle_t h)
+{
+    MC1081_SingleOSCCfg_t cfg = {MC1081_DRCU_16UA, MC1081_AMPOS1_1_2, MC1081_PWR_HIGH};
+    MC1081_SingleOSCSet(h, cfg);
+}
+
+static void OpSingleOSCGet(MC1081_Handle_t h)
+{
+    MC1081_SingleOSCCfg_t cfg;
+    MC1081_SingleOSCGet(h, &cfg);
+}
+
+static void OpChDiffEnableSet(MC1081_Handle_t h)
+{
+    MC1081_ChDiffEn_t en = {.value = 0x00};
+    MC1081_ChDiffEnableSet(h, en);
+}
+
+static void OpChDiffEnableGet(MC1081_Handle_t h)
+{
+    MC1081_ChDiffEn_t en;
+    MC1081_ChDiffEnableGet(h, &en);
+}
+
+static void OpDiffOSCSet(MC1081_Handle_t h)
+{
+    MC1081_DiffOSCCfg_t cfg = {MC1081_DRCU_16UA, MC1081_AMPOS2_1_2, MC1081_PWR_HIGH};
+    MC1081_DiffOSCSet(h, cfg);
+}
+
+static void OpDiffOSCGet(MC1081_Handle_t h)
+{
+    MC1081_DiffOSCCfg_t cfg;
+    MC1081_DiffOSCGet(h, &cfg);
+}
+
+static void OpActiveShieldSet(MC1081_Handle_t h)
+{
+    MC1081_ActiveShielCfg cfg = {MC1081_ACTIVE_SHIELD_OFF, MC1081_SHIELD_PWR_LOW, MC1081_SHIELD_HIGHRES};
+    MC1081_ActiveShieldSet(h, cfg);
+}
+
+static void OpActiveShieldGet(MC1081_Handle_t h)
+{
+    MC1081_ActiveShielCfg cfg;
+    MC1081_ActiveShieldGet(h, &cfg);
+}
+
+static void OpSyncShadow(MC1081_Handle_t h)
+{
+    MC1081_SyncShadow(h);
+}
+
+static void OpPredictFrameTime(MC1081_Handle_t h)
+{
+    uint32_t us;
+    MC1081_PredictFrameTime(h, NULL, &us);
+}
+
+static void OpAcquireWhenReady(MC1081_Handle_t h)
+{
+    MC1081_Snapshot_t s;
+    MC1081_AcquireWhenReady(h, NULL, &s);
+}
+
+/* 切换到单次模式: 之后每次 MC1081_AcquireWhenReady 都启动一次转换 */
+static void SetupSingleShot(MC1081_Handle_t h)
+{
+    MC1081_CapConvConfig_t c = s_cap_cfg;
+    c.start = MC1081_CAP_START_STOP;
+    MC1081_CapMeasureSet(h, c);
+}
+
+/* 单次模式: 以上一帧预测转换时间, 如正常使用那样; 每个句柄各保留一帧 */
+static void OpAcquireSingle(MC1081_Handle_t h)
+{
+    static MC1081_Handle_t owner[2];
+    static MC1081_Snapshot_t last[2];
+    static bool have[2];
+
+    uint8_t i = (owner[0] == NULL || owner[0] == h) ? 0 : 1;
+    owner[i] = h;
+
+    MC1081_Snapshot_t s;
+    if (MC1081_AcquireWhenReady(h, have[i] ? &last[i] : NULL, &s) == MC1081_OK)
+    {
+        last[i] = s;
+        have[i] = true;
+    }
+}
+
+static int LegacyTransmit(const uint8_t *data, const size_t len)
+{
+    (void)data;
+    (void)len;
+    return 0;
+}
+
+static int LegacyReceive(const uint8_t *dst, const size_t len)
+{
+    (void)dst;
+    (void)len;
+    return 0;
+}
+
+/* 句柄创建与释放不访问总线, 只看 CPU 开销 */
+static void OpInitDeInit(MC1081_Handle_t h)
+{
+    (void)h;
+    MC1081_Conf_t conf = {LegacyTransmit, LegacyReceive, NULL};
+    MC1081_Handle_t tmp = NULL;
+    if (MC1081_Init(&tmp, &conf) == MC1081_OK)
+        MC1081_DeInit(&tmp);
+}
+
+static void OpInitBusDeInit(MC1081_Handle_t h)
+{
+    MC1081_Handle_t tmp = NULL;
+    if (MC1081_InitBus(&tmp, &h->bus, h->I2c_addr) == MC1081_OK)
+        MC1081_DeInit(&tmp);
+}
+
+static void OpInitStatic(MC1081_Handle_t h)
+{
+    static MC1081_Obj_t obj;
+    MC1081_InitStatic(&obj, &h->bus, h->I2c_addr);
+}
+
+/* 立即完成的非阻塞传输: 在启动回调里直接走同步总线并上报完成 */
+static int AsyncStartWrite(void *ctx, uint8_t addr, const uint8_t *data, size_t len)
+{
+    MC1081_Handle_t h = (MC1081_Handle_t)ctx;
+    MC1081_AsyncOnComplete(h, h->bus.Write(h->bus.ctx, addr, data, len));
+    return 0;
+}
+
+static int AsyncStartRead(void *ctx, uint8_t addr, uint8_t *dst, size_t len)
+{
+    MC1081_Handle_t h = (MC1081_Handle_t)ctx;
+    MC1081_AsyncOnComplete(h, h->bus.Read(h->bus.ctx, addr, dst, len));
+    return 0;
+}
+
+static void SetupAsync(MC1081_Handle_t h)
+{
+    const MC1081_AsyncBus_t abus = {h, AsyncStartWrite, AsyncStartRead};
+    MC1081_AsyncAttach(h, &abus);
+}
+
+/* MC1081_AsyncStart + 完成回调 + MC1081_AsyncPoll */
+static void OpAsyncSnapshot(MC1081_Handle_t h)
+{
+    MC1081_Snapshot_t s;
+    uint32_t token = 0;
+    if (MC1081_AsyncStart(h, MC1081_ASYNC_SNAPSHOT, 0, &s, NULL, NULL, &token) == MC1081_OK)
+        MC1081_AsyncPoll(h, token);
+}
+
+static void OpAsyncChannel(MC1081_Handle_t h)
+{
+    MC1081_Snapshot_t s;
+    uint32_t token = 0;
+    if (MC1081_AsyncStart(h, MC1081_ASYNC_CHANNEL, 0, &s, NULL, NULL, &token) == MC1081_OK)
+        MC1081_AsyncPoll(h, token);
+}
+
+static const MC1081_DeviceConfig_t s_dev_cfg = {
+    .temp_state = MC1081_TEMP_CONV_ON,
+    .temp_time = MC1081_TEMP_TIME_0P3_MS,
+    .cap = {MC1081_CAP_OSC_SINGLE, MC1081_CAP_TIME_CONT, MC1081_CAP_AVG_1, MC1081_CHIP_SLEEP_OFF, MC1081_CAP_START_PERIODIC},
+    .fin_cycle = 0x40,
+    .clock = {MC1081_FINDIV_4, MC1081_FREFDIV_4, MC1081_FIN_BUILD_4_CYCLE},
+    .ch_single = {.value = 0x07FF},
+    .mch = {.value = 0x00},
+    .osc1 = {MC1081_DRCU_16UA, MC1081_AMPOS1_1_2, MC1081_PWR_HIGH},
+    .ch_diff = {.value = 0x00},
+    .osc2 = {MC1081_DRCU_16UA, MC1081_AMPOS2_1_2, MC1081_PWR_HIGH},
+    .shield = {MC1081_ACTIVE_SHIELD_OFF, MC1081_SHIELD_PWR_LOW, MC1081_SHIELD_HIGHRES},
+};
+
+static void OpDeviceConfigApply(MC1081_Handle_t h)
+{
+    MC1081_DeviceConfigApply(h, &s_dev_cfg);
+}
+
+/* 寄存器映像预先编码, 只计写入 */
+static void OpDeviceConfigApplyRegs(MC1081_Handle_t h)
+{
+    static uint8_t regs[MC1081_CFG_REG_NUM];
+    static bool encoded = false;
+
+    if (!encoded)
+    {
+        MC1081_DeviceConfigEncode(&s_dev_cfg, regs);
+        encoded = true;
+    }
+    MC1081_DeviceConfigApplyRegs(h, regs);
+}
+
+static void OpDeviceConfigGet(MC1081_Handle_t h)
+{
+    MC1081_DeviceConfig_t cfg;
+    MC1081_DeviceConfigGet(h, &cfg);
+}
+
+/* 配置未变: 不访问总线 */
+static void OpDeviceConfigUpdate(MC1081_Handle_t h)
+{
+    MC1081_DeviceConfigUpdate(h, &s_dev_cfg, NULL);
+}
+
+/* 寄存器映像未变: 不访问总线 */
+static void OpDeviceConfigUpdateRegs(MC1081_Handle_t h)
+{
+    static uint8_t regs[MC1081_CFG_REG_NUM];
+    static bool encoded = false;
+
+    if (!encoded)
+    {
+        MC1081_DeviceConfigEncode(&s_dev_cfg, regs);
+        encoded = true;
+    }
+    MC1081_DeviceConfigUpdateRegs(h, regs, NULL);
+}
+
+/* 控制环每周期只改 N */
+static void OpUpdateFinCycle(MC1081_Handle_t h)
+{
+    uint8_t n = 0;
+    MC1081_GetFinCycle(h, &n);
+
+    MC1081_DeviceConfig_t cfg = s_dev_cfg;
+    cfg.fin_cycle = (uint8_t)(n ^ 1U);
+    MC1081_DeviceConfigUpdate(h, &cfg, NULL);
+}
+
+static void OpSoftWareReset(MC1081_Handle_t h)
+{
+    MC1081_SoftWareReset(h);
+}
+
+/* 逐个读取: 11 个单端通道 + 温度 + 溢出 + 状态 */
+static void OpScanPerChannel(MC1081_Handle_t h)
+{
+    uint16_t v;
+    uint8_t c, t;
+
+    MC1081_GetStatus(h, &c, &t);
+    MC1081_GetTempRaw(h, &v);
+    for (uint8_t ch = 0; ch < MC1081_CH_NUM; ch++)
+    {
+        MC1081_GetSigleCHxRaw(h, (MC1081_Channel_Single_t)ch, &v);
+        (void)MC1081_IsSingleChOverflow(h, (MC1081_Channel_Single_t)ch);
+    }
+}
+
+/* 逐个读取: 5 个互电容通道 + 溢出 */
+static void OpScanMutual(MC1081_Handle_t h)
+{
+    uint16_t v;
+    for (uint8_t ch = 0; ch < MC1081_MCH_NUM; ch++)
+    {
+        MC1081_GetMCHxRaw(h, (MC1081_Channel_MCH_t)ch, &v);
+        (void)MC1081_IsMChOverflow(h, (MC1081_Channel_MCH_t)ch);
+    }
+}
+
+/* 逐个寄存器完成上电配置, 与 MC1081_DeviceConfigApply 对比 */
+static void OpBringupPerRegister(MC1081_Handle_t h)
+{
+    MC1081_TempConfig(h, s_dev_cfg.temp_state, s_dev_cfg.temp_time);
+    MC1081_SetFinCycle(h, s_dev_cfg.fin_cycle);
+    MC1081_SetClockConfig(h, s_dev_cfg.clock);
+    MC1081_ChSingleEnableSet(h, s_dev_cfg.ch_single);
+    MC1081_MchxEnableSet(h, s_dev_cfg.mch);
+    MC1081_SingleOSCSet(h, s_dev_cfg.osc1);
+    MC1081_ChDiffEnableSet(h, s_dev_cfg.ch_diff);
+    MC1081_DiffOSCSet(h, s_dev_cfg.osc2);
+    MC1081_ActiveShieldSet(h, s_dev_cfg.shield);
+    MC1081_CapMeasureSet(h, s_dev_cfg.cap);
+}
+
+/* 整帧: 一次突发读取 */
+static void OpScanSnapshot(MC1081_Handle_t h)
+{
+    MC1081_Snapshot_t s;
+    MC1081_ReadSnapshot(h, &s);
+}
+
+/* 按计划读取: 只使能通道 0 与 3, 附带溢出与状态 */
+static void OpScanPlanned(MC1081_Handle_t h)
+{
+    static MC1081_ScanPlan_t plan;
+    if (plan.num == 0)
+    {
+        MC1081_DeviceConfig_t cfg = s_dev_cfg;
+        cfg.ch_single.value = 0x0009;
+        MC1081_ScanPlanMake(&plan, &cfg, MC1081_SCAN_FLAGS | s_scan_bus, 400000, 0);
+    }
+
+    MC1081_Snapshot_t s;
+    MC1081_ScanRead(h, &plan, &s);
+}
+
+/* 只计算计划, 不访问总线 */
+static void OpScanPlanMake(MC1081_Handle_t h)
+{
+    (void)h;
+    MC1081_ScanPlan_t plan;
+    MC1081_ScanPlanMake(&plan, &s_dev_cfg, MC1081_SCAN_TEMP | MC1081_SCAN_FLAGS | s_scan_bus, 400000, 0);
+}
+
+/* 按完整配置的计划读取 */
+static void OpScanRead(MC1081_Handle_t h)
+{
+    static MC1081_ScanPlan_t plan;
+    if (plan.num == 0)
+        MC1081_ScanPlanMake(&plan, &s_dev_cfg, MC1081_SCAN_TEMP | MC1081_SCAN_FLAGS | s_scan_bus, 400000, 0);
+
+    MC1081_Snapshot_t s;
+    MC1081_ScanRead(h, &plan, &s);
+}
+
+/* 运行时读取配置再决策, 如控制环每周期所做 */
+static void OpConfigReadback(MC1081_Handle_t h)
+{
+    OpCapMeasureGet(h);
+    OpGetClockConfig(h);
+    OpGetFinCycle(h);
+    OpSingleOSCGet(h);
+    OpActiveShieldGet(h);
+}
+
+typedef struct
+{
+    const char *name;
+    BenchOp_t fn;
+    BenchOp_t setup; /* 预热前在两个句柄上各执行一次, 可为 NULL */
+} BenchCase_t;
+
+static const BenchCase_t s_cases[] = {
+    {"MC1081_Init+DeInit", OpInitDeInit, NULL},
+    {"MC1081_InitBus+DeInit", OpInitBusDeInit, NULL},
+    {"MC1081_InitStatic", OpInitStatic, NULL},
+    {"MC1081_GetTempRaw", OpGetTempRaw, NULL},
+    {"MC1081_GetSigleCHxRaw", OpGetSigleCHxRaw, NULL},
+    {"MC1081_GetMCHxRaw", OpGetMCHxRaw, NULL},
+    {"MC1081_GetDiffDCHxRaw", OpGetDiffDCHxRaw, NULL},
+    {"MC1081_ReadSnapshot", OpReadSnapshot, NULL},
+    {"MC1081_ReadFrame", OpReadFrame, NULL},
+    {"MC1081_IsSingleChOverflow", OpIsSingleChOverflow, NULL},
+    {"MC1081_CheckchxOverflow_Diff", OpCheckchxOverflow_Diff, NULL},
+    {"MC1081_IsMChOverflow", OpIsMChOverflow, NULL},
+    {"MC1081_ClearOverflowFlag", OpClearOverflowFlag, NULL},
+    {"MC1081_GetStatus", OpGetStatus, NULL},
+    {"MC1081_TempConfig", OpTempConfig, NULL},
+    {"MC1081_CapMeasureSet", OpCapMeasureSet, NULL},
+    {"MC1081_CapMeasureGet", OpCapMeasureGet, NULL},
+    {"MC1081_SetFinCycle", OpSetFinCycle, NULL},
+    {"MC1081_GetFinCycle", OpGetFinCycle, NULL},
+    {"MC1081_SetClockConfig", OpSetClockConfig, NULL},
+    {"MC1081_GetClockConfig", OpGetClockConfig, NULL},
+    {"MC1081_ChSingleEnableSet", OpChSingleEnableSet, NULL},
+    {"MC1081_ChSingleEnableGet", OpChSingleEnableGet, NULL},
+    {"MC1081_MchxEnableSet", OpMchxEnableSet, NULL},
+    {"MC1081_MchxEnableGet", OpMchxEnableGet, NULL},
+    {"MC1081_SingleOSCSet", OpSingleOSCSet, NULL},
+    {"MC1081_SingleOSCGet", OpSingleOSCGet, NULL},
+    {"MC1081_ChDiffEnableSet", OpChDiffEnableSet, NULL},
+    {"MC1081_ChDiffEnableGet", OpChDiffEnableGet, NULL},
+    {"MC1081_DiffOSCSet", OpDiffOSCSet, NULL},
+    {"MC1081_DiffOSCGet", OpDiffOSCGet, NULL},
+    {"MC1081_ActiveShieldSet", OpActiveShieldSet, NULL},
+    {"MC1081_ActiveShieldGet", OpActiveShieldGet, NULL},
+    {"MC1081_SyncShadow", OpSyncShadow, NULL},
+    {"MC1081_PredictFrameTime", OpPredictFrameTime, NULL},
+    {"MC1081_AcquireWhenReady", OpAcquireWhenReady, NULL},
+    {"MC1081_DeviceConfigApply", OpDeviceConfigApply, NULL},
+    {"MC1081_DeviceConfigApplyRegs", OpDeviceConfigApplyRegs, NULL},
+    {"MC1081_DeviceConfigGet", OpDeviceConfigGet, NULL},
+    {"MC1081_DeviceConfigUpdate", OpDeviceConfigUpdate, NULL},
+    {"MC1081_DeviceConfigUpdateRegs", OpDeviceConfigUpdateRegs, NULL},
+    {"MC1081_ScanPlanMake", OpScanPlanMake, NULL},
+    {"MC1081_ScanRead", OpScanRead, NULL},
+    {"MC1081_AsyncStart.snapshot", OpAsyncSnapshot, SetupAsync},
+    {"MC1081_AsyncStart.channel", OpAsyncChannel, SetupAsync},
+    {"scan.update_fin_cycle", OpUpdateFinCycle, NULL},
+    {"scan.bringup_per_register", OpBringupPerRegister, NULL},
+    {"scan.per_channel", OpScanPerChannel, NULL},
+    {"scan.mutual", OpScanMutual, NULL},
+    {"scan.snapshot", OpScanSnapshot, NULL},
+    {"scan.planned", OpScanPlanned, NULL},
+    {"scan.config_readback", OpConfigReadback, NULL},
+    {"MC1081_AcquireWhenReady.single", OpAcquireSingle, SetupSingleShot}, /* 之后保持单次模式 */
+    {"MC1081_SoftWareReset", OpSoftWareReset, NULL}, /* 最后执行: 会停止转换 */
+};
+
+static uint64_t NowNs(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ULL + (uint64_t)ts.tv_nsec;
+}
+
+static double BusUs(uint64_t clocks, double scl_hz)
+{
+    return (double)clocks * 1e6 / scl_hz;
+}
+
+int main(int argc, char **argv)
+{
+    const int combined = (argc > 1 && strcmp(argv[1], "--combined") == 0);
+
+    MC1081_SimBus_t sim_bus;
+    MC1081_Sim_t sim_dev;
+    MC1081_SimBusInit(&sim_bus, 400000);
+    MC1081_SimInit(&sim_dev, MC1081_DEFAULT_I2CADDR);
+    MC1081_SimBusAttach(&sim_bus, &sim_dev);
+
+    BenchBus_t wire = {0};
+    MC1081_SimBusInterface(&sim_bus, &wire.inner);
+    BenchBus_t null_bus = {0};
+
+    MC1081_Bus_t bus_wire = {&wire, BenchWrite, BenchRead, BenchDelay, NULL, NULL};
+    MC1081_Bus_t bus_null = {&null_bus, BenchWrite, BenchRead, BenchDelay, NULL, NULL};
+    if (combined)
+    {
+        bus_wire.ReadRegs = BenchReadRegs;
+        bus_null.ReadRegs = BenchReadRegs;
+        s_scan_bus = MC1081_SCAN_COMBINED;
+    }
+
+    MC1081_Obj_t obj_wire, obj_null;
+    MC1081_InitStatic(&obj_wire, &bus_wire, MC1081_DEFAULT_I2CADDR);
+    MC1081_InitStatic(&obj_null, &bus_null, MC1081_DEFAULT_I2CADDR);
+
+    /* 启动连续测量, 使读取的数据是真实转换结果 */
+    OpChSingleEnableSet(&obj_wire);
+    OpSingleOSCSet(&obj_wire);
+    OpSetClockConfig(&obj_wire);
+    OpCapMeasureSet(&obj_wire);
+
+    for (size_t i = 0; i < sizeof(s_cases) / sizeof(s_cases[0]); i++)
+    {
+        const BenchCase_t *c = &s_cases[i];
+
+        if (c->setup != NULL)
+        {
+            c->setup(&obj_wire);
+            c->setup(&obj_null);
+        }
+
+        /* 预热一次, 使影子寄存器等状态进入稳态 */
+        c->fn(&obj_wire);
+        c->fn(&obj_null);
+
+        wire.tx = 0;
+        wire.wr_bytes = 0;
+        wire.rd_bytes = 0;
+        wire.clocks = 0;
+        c->fn(&obj_wire);
+
+        const uint64_t t0 = NowNs();
+        for (unsigned long n = 0; n < BENCH_CPU_LOOPS; n++)
+        {
+            c->fn(&obj_null);
+        }
+        const double cpu_ns = (double)(NowNs() - t0) / BENCH_CPU_LOOPS;
+
+        printf("{\"op\":\"%s\",\"tx\":%llu,\"wr_bytes\":%llu,\"rd_bytes\":%llu,"
+               "\"bus_us_100k\":%.1f,\"bus_us_400k\":%.1f,\"bus_us_1m\":%.1f,\"cpu_ns\":%.1f}\n",
+               c->name, (unsigned long long)wire.tx, (unsigned long long)wire.wr_bytes,
+               (unsigned long long)wire.rd_bytes, BusUs(wire.clocks, 100000.0),
+               BusUs(wire.clocks, 400000.0), BusUs(wire.clocks, 1000000.0), cpu_ns);
+    }
+
+    return 0;
+}
@@ -0,0 +1,264 @@
+/**
+ * @file mc1081_engine_bench.c
+ * @brief Throughput scaling of the acquisition engine over 1 ~ 64 devices.
+ *
+ * Devices are simulated, four per simulated bus (one per address strap), all
+ * with the same single-shot configuration. For each device count three modes
+ * read the same number of rounds:
+ *
+ *   loop         one thread calls MC1081_AcquireWhenReady() on every device
+ *   threads      the engine, one worker per bus, devices of a bus in series
+ *   interleaved  the engine, conversions of a bus overlapped with readouts
+ *
+ * Each line of the output is one JSON object:
+ *
+ *   {"devices":..,"buses":..,"mode":"...","round_us":..,"dev_hz":..,
+ *    "total_hz":..,"scaling":..,"bus_pct":..,"skew_us":..,"cpu_ns":..}
+ *
+ * Time is the virtual time of the simulated buses: a loop waits for every bus
+ * in turn, so its round takes the sum of all buses; the engine's buses run in
+ * parallel, so its round takes the slowest bus. dev_hz is the frame rate of
+ * one device, total_hz of all devices, scaling is total_hz relative to one
+ * device in the same mode. bus_pct is the mean share of a bus spent on reads,
+ * skew_us the largest spread of conversion ends on one bus within a round
+ * (each simulated bus has its own clock), cpu_ns the host time per frame.
+ *
+ * Build (from the repository root):
+ *   gcc -O2 -pthread -Iinclude bench/mc1081_engine_bench.c src/MC1081_engine.c src/MC1081.c src/MC1081_sim.c -lm -o mc1081_engine_bench
+ *
+ * Usage: mc1081_engine_bench [rounds]
+ */
+
+#define _POSIX_C_SOURCE 200809L
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "MC1081_engine.h"
+#include "MC1081_sim.h"
+
+#define BENCH_SCL_HZ (400000UL)
+#define BENCH_PER_BUS (MC1081_SIM_BUS_MAX_DEV)
+#define BENCH_MAX_BUS (MC1081_ENGINE_MAX_DEV / BENCH_PER_BUS)
+
+typedef enum
+{
+    MODE_LOOP,
+    MODE_THREADS,
+    MODE_INTERLEAVED,
+    MODE_NUM,
+} BenchMode_t;
+
+static const char *const s_mode_names[MODE_NUM] = {"loop", "threads", "interleaved"};
+
+/* 4 个通道, 单次转换, 约 1.6 ms 一帧; 400 kHz 下读一次结果块约 0.7 ms */
+static const MC1081_DeviceConfig_t s_dev_cfg = {
+    .temp_state = MC1081_TEMP_CONV_OFF,
+    .temp_time = MC1081_TEMP_TIME_0P3_MS,
+    .cap = {MC1081_CAP_OSC_SINGLE, MC1081_CAP_TIME_CONT, MC1081_CAP_AVG_1, MC1081_CHIP_SLEEP_OFF, MC1081_CAP_START_STOP},
+    .fin_cycle = 0x40,
+    .clock = {MC1081_FINDIV_4, MC1081_FREFDIV_4, MC1081_FIN_BUILD_4_CYCLE},
+    .ch_single = {.value = 0x000F},
+    .mch = {.value = 0x00},
+    .osc1 = {MC1081_DRCU_16UA, MC1081_AMPOS1_1_2, MC1081_PWR_HIGH},
+    .ch_diff = {.value = 0x00},
+    .osc2 = {MC1081_DRCU_16UA, MC1081_AMPOS2_1_2, MC1081_PWR_HIGH},
+    .shield = {MC1081_ACTIVE_SHIELD_OFF, MC1081_SHIELD_PWR_LOW, MC1081_SHIELD_HIGHRES},
+};
+
+static const uint8_t s_straps[BENCH_PER_BUS] = {0x01, 0x02, 0x04, 0x08}; /* GND, VDD, SDA, SCL */
+
+/* 测试台放在静态区, 64 个设备的引擎有数十 KB */
+static MC1081_SimBus_t s_sim_bus[BENCH_MAX_BUS];
+static MC1081_Sim_t s_sim_dev[MC1081_ENGINE_MAX_DEV];
+static MC1081_Bus_t s_bus[BENCH_MAX_BUS];
+static MC1081_Obj_t s_obj[MC1081_ENGINE_MAX_DEV];
+static MC1081_Engine_t s_eng;
+
+static uint64_t NowNs(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ULL + (uint64_t)ts.tv_nsec;
+}
+
+/**
+ * @brief 建立 n 个设备, 每条总线 4 个, 返回总线数
+ */
+static uint8_t Setup(uint8_t n)
+{
+    const uint8_t buses = (uint8_t)((n + BENCH_PER_BUS - 1) / BENCH_PER_BUS);
+
+    for (uint8_t b = 0; b < buses; b++)
+    {
+        MC1081_SimBusInit(&s_sim_bus[b], BENCH_SCL_HZ);
+        MC1081_SimBusInterface(&s_sim_bus[b], &s_bus[b]);
+    }
+
+    for (uint8_t i = 0; i < n; i++)
+    {
+        MC1081_AddrSel_t sel = {.value = s_straps[i % BENCH_PER_BUS]};
+        const uint8_t addr = MC1081_CalI2cAddr(sel);
+        const uint8_t b = (uint8_t)(i / BENCH_PER_BUS);
+
+        MC1081_SimInit(&s_sim_dev[i], addr);
+        s_sim_dev[i].seed = 1U + i;
+        for (uint8_t c = 0; c < MC1081_CH_NUM; c++)
+        {
+            s_sim_dev[i].ch[c].base = 10000 + 20 * i; /* 设备间电容略有差异, 转换时间也不同 */
+            s_sim_dev[i].ch[c].noise = 20;
+        }
+        MC1081_SimBusAttach(&s_sim_bus[b], &s_sim_dev[i]);
+
+        MC1081_InitStatic(&s_obj[i], &s_bus[b], addr);
+        MC1081_SetClock(&s_obj[i], MC1081_SimBusClock, &s_sim_bus[b]);
+        MC1081_DeviceConfigApply(&s_obj[i], &s_dev_cfg);
+    }
+
+    return buses;
+}
+
+static uint64_t BusTime(uint8_t buses, uint64_t *max_ns)
+{
+    uint64_t sum = 0;
+    *max_ns = 0;
+    for (uint8_t b = 0; b < buses; b++)
+    {
+        sum += s_sim_bus[b].now_ns;
+        if (s_sim_bus[b].now_ns > *max_ns)
+            *max_ns = s_sim_bus[b].now_ns;
+    }
+    return sum;
+}
+
+static void Report(uint8_t n, uint8_t buses, BenchMode_t mode, uint32_t rounds, uint64_t span_ns, uint32_t bus_pct,
+                   uint64_t skew_ns, uint64_t cpu_ns, double *base_hz)
+{
+    const double round_us = (double)span_ns / 1000.0 / rounds;
+    const double dev_hz = 1e6 / round_us;
+    const double total_hz = dev_hz * n;
+
+    if (n == 1)
+        base_hz[mode] = total_hz;
+
+    printf("{\"devices\":%u,\"buses\":%u,\"mode\":\"%s\",\"round_us\":%.1f,\"dev_hz\":%.1f,\"total_hz\":%.1f,"
+           "\"scaling\":%.2f,\"bus_pct\":%u,\"skew_us\":%.1f,\"cpu_ns\":%.0f}\n",
+           n, buses, s_mode_names[mode], round_us, dev_hz, total_hz, total_hz / base_hz[mode], bus_pct,
+           (double)skew_ns / 1000.0, (double)cpu_ns / ((double)rounds * n));
+}
+
+static void RunLoop(uint8_t n, uint32_t rounds, double *base_hz)
+{
+    const uint8_t buses = Setup(n);
+    MC1081_Snapshot_t last[MC1081_ENGINE_MAX_DEV];
+    uint64_t busy_ns = 0;
+    uint64_t max_ns = 0;
+    uint64_t skew_ns = 0;
+
+    const uint64_t t0 = BusTime(buses, &max_ns);
+    const uint64_t c0 = NowNs();
+
+    for (uint32_t k = 0; k < rounds; k++)
+    {
+        /* 与引擎的 bus_skew_ns 相同: 每轮每条总线上成功帧的转换结束时刻之差 */
+        uint64_t lo[BENCH_MAX_BUS];
+        uint64_t hi[BENCH_MAX_BUS];
+        uint8_t good[BENCH_MAX_BUS] = {0};
+
+        for (uint8_t i = 0; i < n; i++)
+        {
+            const MC1081_Status_t sta = MC1081_AcquireWhenReady(&s_obj[i], (k > 0) ? &last[i] : NULL, &last[i]);
+            busy_ns += s_obj[i].time.bus_ns - s_obj[i].time.request_ns;
+            if (sta != MC1081_OK)
+                continue;
+
+            const uint8_t b = (uint8_t)(i / BENCH_PER_BUS);
+            const uint64_t t = s_obj[i].time.conv_ns;
+            if (good[b] == 0 || t < lo[b])
+                lo[b] = t;
+            if (good[b] == 0 || t > hi[b])
+                hi[b] = t;
+            good[b]++;
+        }
+
+        for (uint8_t b = 0; b < buses; b++)
+        {
+            if (good[b] > 1 && hi[b] - lo[b] > skew_ns)
+                skew_ns = hi[b] - lo[b];
+        }
+    }
+
+    const uint64_t cpu_ns = NowNs() - c0;
+    const uint64_t span_ns = BusTime(buses, &max_ns) - t0;
+
+    Report(n, buses, MODE_LOOP, rounds, span_ns, (uint32_t)((busy_ns * 100U) / span_ns), skew_ns, cpu_ns, base_hz);
+}
+
+static void RunEngine(uint8_t n, uint32_t rounds, BenchMode_t mode, double *base_hz)
+{
+    const uint8_t buses = Setup(n);
+    const MC1081_EngineCfg_t cfg = {
+        .rounds = rounds,
+        .depth = 1,
+        .serial = (mode == MODE_THREADS),
+    };
+
+    MC1081_EngineInit(&s_eng, &cfg);
+    for (uint8_t b = 0; b < buses; b++)
+        MC1081_EngineAddBus(&s_eng, &s_bus[b], MC1081_SimBusClock, &s_sim_bus[b], NULL);
+    for (uint8_t i = 0; i < n; i++)
+        MC1081_EngineAddDevice(&s_eng, (uint8_t)(i / BENCH_PER_BUS), &s_obj[i], NULL, NULL);
+
+    uint64_t max_ns = 0;
+    BusTime(buses, &max_ns);
+    const uint64_t t0 = max_ns;
+    const uint64_t c0 = NowNs();
+
+    MC1081_EngineStart(&s_eng);
+    MC1081_EngineWait(&s_eng);
+
+    const uint64_t cpu_ns = NowNs() - c0;
+    BusTime(buses, &max_ns);
+
+    MC1081_EngineStats_t st;
+    MC1081_EngineStats(&s_eng, &st);
+
+    uint32_t bus_pct = 0;
+    for (uint8_t b = 0; b < buses; b++)
+    {
+        uint32_t pct = 0;
+        for (uint8_t i = 0; i < s_eng.bus[b].num; i++)
+        {
+            MC1081_EngineDevStats_t ds;
+            MC1081_EngineDevStats(&s_eng, s_eng.bus[b].dev[i], &ds);
+            pct += ds.bus_pct;
+        }
+        bus_pct += pct;
+    }
+
+    if (st.frames != (uint32_t)rounds * n || st.rounds != rounds)
+        fprintf(stderr, "%s/%u: %u frames, %u errors, %u rounds\n", s_mode_names[mode], n, st.frames, st.errors, st.rounds);
+
+    Report(n, buses, mode, rounds, max_ns - t0, bus_pct / buses, st.bus_skew_ns, cpu_ns, base_hz);
+    MC1081_EngineDeInit(&s_eng);
+}
+
+int main(int argc, char **argv)
+{
+    static const uint8_t counts[] = {1, 4, 16, 64};
+    const uint32_t rounds = (argc > 1) ? (uint32_t)strtoul(argv[1], NULL, 0) : 200U;
+    double base_hz[MODE_NUM] = {0};
+
+    if (rounds == 0)
+        return 1;
+
+    for (size_t c = 0; c < sizeof(counts) / sizeof(counts[0]); c++)
+    {
+        RunLoop(counts[c], rounds, base_hz);
+        RunEngine(counts[c], rounds, MODE_THREADS, base_hz);
+        RunEngine(counts[c], rounds, MODE_INTERLEAVED, base_hz);
+    }
+
+    return 0;
+}
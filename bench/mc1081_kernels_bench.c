@@ -0,0 +1,186 @@
+/**
+ * @file mc1081_kernels_bench.c
+ * @brief Throughput of the block kernels per instruction set.
+ *
+ * Every kernel of every instruction set available on this CPU runs over the
+ * same block of synthetic channel words (with ~1% saturated words). Each line
+ * of the output is one JSON object:
+ *
+ *   {"kernel":"...","isa":"...","n":..,"gbps":..,"speedup":..,"match":true}
+ *
+ * gbps counts the bytes read and written per second, speedup is relative to
+ * the scalar table, and match tells whether the output equals the scalar
+ * output (bit-exact for integer kernels, within 1 ulp-ish for float).
+ *
+ * Build (from the repository root):
+ *   gcc -O2 -Iinclude bench/mc1081_kernels_bench.c src/MC1081_kernels.c src/MC1081_conv.c src/MC1081.c -lm -o mc1081_kernels_bench
+ *
+ * Usage: mc1081_kernels_bench [samples]
+ */
+
+#define _POSIX_C_SOURCE 200809L
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "MC1081_kernels.h"
+
+#define BENCH_MIN_NS (200000000ULL)
+
+typedef enum
+{
+    K_DECODE,
+    K_FIXED,
+    K_FIXED_REF,
+    K_FLOAT,
+    K_FLOAT_REF,
+    K_NUM,
+} KernelId_t;
+
+static const char *const s_kernel_names[K_NUM] = {"decode", "fixed", "fixed_ref", "float", "float_ref"};
+
+typedef struct
+{
+    const uint8_t *src;
+    const uint8_t *ref;
+    void *dst;
+    size_t n;
+    const MC1081_KParam_t *p;
+} BenchArgs_t;
+
+static uint64_t NowNs(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ULL + (uint64_t)ts.tv_nsec;
+}
+
+static void RunKernel(const MC1081_Kernels_t *k, KernelId_t id, const BenchArgs_t *a)
+{
+    switch (id)
+    {
+    case K_DECODE:
+        k->Decode(a->src, (uint16_t *)a->dst, a->n);
+        break;
+    case K_FIXED:
+        k->Fixed(a->src, NULL, (int32_t *)a->dst, a->n, a->p);
+        break;
+    case K_FIXED_REF:
+        k->Fixed(a->src, a->ref, (int32_t *)a->dst, a->n, a->p);
+        break;
+    case K_FLOAT:
+        k->Float(a->src, NULL, (float *)a->dst, a->n, a->p);
+        break;
+    default:
+        k->Float(a->src, a->ref, (float *)a->dst, a->n, a->p);
+        break;
+    }
+}
+
+static size_t BytesMoved(KernelId_t id, size_t n)
+{
+    const size_t in = (id == K_FIXED_REF || id == K_FLOAT_REF) ? 4 * n : 2 * n;
+    const size_t out = (id == K_DECODE) ? 2 * n : 4 * n;
+    return in + out;
+}
+
+static double Measure(const MC1081_Kernels_t *k, KernelId_t id, const BenchArgs_t *a)
+{
+    RunKernel(k, id, a); // 预热
+
+    uint64_t loops = 0;
+    const uint64_t t0 = NowNs();
+    uint64_t t1 = t0;
+    do
+    {
+        RunKernel(k, id, a);
+        loops++;
+        t1 = NowNs();
+    } while (t1 - t0 < BENCH_MIN_NS);
+
+    return (double)BytesMoved(id, a->n) * (double)loops / (double)(t1 - t0);
+}
+
+static bool Matches(KernelId_t id, const void *out, const void *expect, size_t n)
+{
+    if (id == K_FLOAT || id == K_FLOAT_REF)
+    {
+        const float *a = (const float *)out;
+        const float *b = (const float *)expect;
+        for (size_t i = 0; i < n; i++)
+        {
+            if (isinf(a[i]) != isinf(b[i]) || (!isinf(a[i]) && fabsf(a[i] - b[i]) > 1e-6f * (1.0f + fabsf(b[i]))))
+                return false;
+        }
+        return true;
+    }
+
+    return memcmp(out, expect, ((id == K_DECODE) ? 2 : 4) * n) == 0;
+}
+
+int main(int argc, char **argv)
+{
+    const size_t n = (argc > 1) ? (size_t)strtoul(argv[1], NULL, 0) : (1U << 20);
+
+    uint8_t *src = malloc(2 * n);
+    uint8_t *ref = malloc(2 * n);
+    void *out = malloc(4 * n);
+    void *expect = malloc(4 * n);
+    if (src == NULL || ref == NULL || out == NULL || expect == NULL)
+        return 1;
+
+    uint32_t seed = 0x1081;
+    for (size_t i = 0; i < n; i++)
+    {
+        seed = seed * 1664525U + 1013904223U;
+        const uint16_t x = ((seed >> 8) % 100 == 0) ? 0xFFFF : (uint16_t)(20000 + (seed >> 20));
+        const uint16_t r = (uint16_t)(21000 + ((seed >> 4) & 0x3FF));
+        src[2 * i] = (uint8_t)(x >> 8);
+        src[2 * i + 1] = (uint8_t)x;
+        ref[2 * i] = (uint8_t)(r >> 8);
+        ref[2 * i + 1] = (uint8_t)r;
+    }
+
+    /* 默认配置: N = 40, 16 uA, 0.8 V, 约 31 fF / count */
+    MC1081_Conv_t conv;
+    MC1081_ConvInit(&conv, 0, 0);
+    const MC1081_ClockCfg_t clk = {MC1081_FINDIV_1, MC1081_FREFDIV_1, 0};
+    const MC1081_SingleOSCCfg_t osc = {MC1081_DRCU_16UA, MC1081_AMPOS1_0_8, MC1081_PWR_LOW};
+    MC1081_ConvSetupSingle(&conv, clk, 40, osc);
+
+    MC1081_KParam_t p;
+    if (MC1081_KParamInit(&p, &conv, 72090 /* 1.1 */, -1500) != MC1081_OK)
+        return 1;
+
+    const MC1081_Kernels_t *scalar = MC1081_KernelsGet(MC1081_ISA_SCALAR);
+
+    for (KernelId_t id = 0; id < K_NUM; id++)
+    {
+        BenchArgs_t a = {src, ref, expect, n, &p};
+        const double base = Measure(scalar, id, &a);
+
+        for (MC1081_Isa_t isa = 0; isa < MC1081_ISA_NUM; isa++)
+        {
+            const MC1081_Kernels_t *k = MC1081_KernelsGet(isa);
+            if (k == NULL)
+                continue;
+
+            a.dst = out;
+            memset(out, 0, 4 * n);
+            const double gbps = (isa == MC1081_ISA_SCALAR) ? base : Measure(k, id, &a);
+            if (isa == MC1081_ISA_SCALAR)
+                RunKernel(k, id, &a);
+
+            printf("{\"kernel\":\"%s\",\"isa\":\"%s\",\"n\":%zu,\"gbps\":%.2f,\"speedup\":%.2f,\"match\":%s}\n",
+                   s_kernel_names[id], k->name, n, gbps, gbps / base, Matches(id, out, expect, n) ? "true" : "false");
+        }
+    }
+
+    free(src);
+    free(ref);
+    free(out);
+    free(expect);
+    return 0;
+}
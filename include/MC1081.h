@@ -29,6 +29,28 @@ extern "C"
  */
 extern MC1081_Status_t MC1081_Init(MC1081_Handle_t *handle, MC1081_Conf_t *conf);
 
+/**
+ * @brief Initializes the device instance handle on a shared bus.
+ * @note The handle must be initialized to `NULL` before calling this function.
+ *       Several handles may use the same bus (and ctx) with different addresses.
+ * @param handle [out] Pointer to the device handle to be initialized.
+ * @param bus    [in]  Pointer to the bus interface, copied into the handle.
+ * @param addr   [in]  7-bit I2C address, see MC1081_CalI2cAddr().
+ * @return MC1081_Status_t Operation status code.
+ */
+extern MC1081_Status_t MC1081_InitBus(MC1081_Handle_t *handle, const MC1081_Bus_t *bus, uint8_t addr);
+
+/**
+ * @brief Initializes a device instance in caller-provided storage, without any allocation.
+ * @note The storage itself is the handle: `MC1081_Handle_t sensor = &storage;`.
+ *       MC1081_DeInit() on such a handle only clears the storage.
+ * @param storage [out] Object storage, e.g. a static `MC1081_Obj_t`.
+ * @param bus     [in]  Pointer to the bus interface, copied into the object.
+ * @param addr    [in]  7-bit I2C address, see MC1081_CalI2cAddr().
+ * @return MC1081_Status_t Operation status code.
+ */
+extern MC1081_Status_t MC1081_InitStatic(MC1081_Obj_t *storage, const MC1081_Bus_t *bus, uint8_t addr);
+
 /**
  * @brief Reads the raw temperature value.
  * @param handle [in]  Device handle.
@@ -64,6 +86,45 @@ extern MC1081_Status_t MC1081_GetSigleCHxRaw(MC1081_Handle_t handle, MC1081_Chan
  */
 extern MC1081_Status_t MC1081_GetDiffDCHxRaw(MC1081_Handle_t handle, MC1081_Channel_Diff_t ch, uint16_t *raw);
 
+/**
+ * @brief Reads the whole result block (temperature, all channels, overflow and status)
+ *        in one auto-increment burst.
+ * @param handle [in]  Device handle.
+ * @note Attached processing stages (see MC1081_StageAttach()) run on the frame.
+ * @param snap   [out] Pointer to store the decoded snapshot.
+ * @return MC1081_Status_t MC1081_DROP_ERR if a stage dropped the frame.
+ */
+extern MC1081_Status_t MC1081_ReadSnapshot(MC1081_Handle_t handle, MC1081_Snapshot_t *snap);
+
+/**
+ * @brief Plans the reads of the result registers needed by a configuration.
+ * @note  The enabled channels of the active oscillator (cfg->cap.osc_mode) decide which
+ *        words are needed. Needed words are read in runs, and two runs are joined when
+ *        reading the registers between them costs less than another write + read pair
+ *        (31 SCL clocks plus overhead_ns), or with MC1081_SCAN_COMBINED another pointer
+ *        write and repeated start (28 SCL clocks). If more than MC1081_SCAN_MAX_BURSTS
+ *        runs remain, the runs with the smallest gaps are joined until the plan fits.
+ * @param plan        [out] Plan.
+ * @param cfg         [in]  Configuration, e.g. from MC1081_DeviceConfigGet().
+ * @param flags       [in]  MC1081_SCAN_TEMP and / or MC1081_SCAN_FLAGS, plus MC1081_SCAN_COMBINED
+ *                          when the handle's bus sets MC1081_Bus_t::ReadRegs.
+ * @param scl_hz      [in]  Bus clock.
+ * @param overhead_ns [in]  Host cost of one transaction beyond its bus time.
+ * @return MC1081_Status_t MC1081_PARAM_ERR if nothing is to be read.
+ */
+extern MC1081_Status_t MC1081_ScanPlanMake(MC1081_ScanPlan_t *plan, const MC1081_DeviceConfig_t *cfg, uint8_t flags,
+                                           uint32_t scl_hz, uint32_t overhead_ns);
+
+/**
+ * @brief Reads a frame with a scan plan.
+ * @note Words outside the plan read 0. Attached stages run on the frame.
+ * @param handle [in]  Device handle.
+ * @param plan   [in]  Plan from MC1081_ScanPlanMake().
+ * @param snap   [out] Decoded frame.
+ * @return MC1081_Status_t MC1081_DROP_ERR if a stage dropped the frame.
+ */
+extern MC1081_Status_t MC1081_ScanRead(MC1081_Handle_t handle, const MC1081_ScanPlan_t *plan, MC1081_Snapshot_t *snap);
+
 /**
  * @brief Checks if a Single-Ended channel has an overflow condition.
  * @param handle [in] Device handle.
@@ -264,6 +325,308 @@ extern MC1081_Status_t MC1081_ActiveShieldGet(MC1081_Handle_t handle, MC1081_Act
  */
 extern MC1081_Status_t MC1081_SoftWareReset(MC1081_Handle_t handle);
 
+/**
+ * @brief Re-reads configuration registers 0x1C ~ 0x26 into the handle's shadow copy.
+ * @note  The `*Get` functions are served from the shadow copy once it is valid.
+ *        A STATUS read that shows a single-shot conversion ended sets OS back to stop in
+ *        the copy, as the chip does.
+ *        Call this after an external reset or a suspected register upset.
+ * @param handle [in] Device handle.
+ * @return MC1081_Status_t Operation status code.
+ */
+extern MC1081_Status_t MC1081_SyncShadow(MC1081_Handle_t handle);
+
+/**
+ * @brief Writes the whole configuration block 0x1C ~ 0x26.
+ * @note  The block goes out in one auto-increment write with temperature and
+ *        capacitance conversion stopped, then a second write of T_CMD / C_CMD
+ *        starts them, so the chip never converts with a partly applied setup.
+ *        The second write is skipped when neither conversion is started.
+ * @param handle [in] Device handle.
+ * @param cfg    [in] Configuration.
+ * @return MC1081_Status_t Operation status code.
+ */
+extern MC1081_Status_t MC1081_DeviceConfigApply(MC1081_Handle_t handle, const MC1081_DeviceConfig_t *cfg);
+
+/**
+ * @brief Writes an encoded configuration block, as MC1081_DeviceConfigApply() does.
+ * @note For register images prepared ahead, e.g. by MC1081_DeviceConfigEncode() or the
+ *       compile-time encoder of MC1081.hpp.
+ * @param handle [in] Device handle.
+ * @param regs   [in] MC1081_CFG_REG_NUM register values, 0x1C first.
+ * @return MC1081_Status_t Operation status code.
+ */
+extern MC1081_Status_t MC1081_DeviceConfigApplyRegs(MC1081_Handle_t handle, const uint8_t *regs);
+
+/**
+ * @brief Reads the whole configuration block, from the shadow copy when it is valid.
+ * @param handle [in]  Device handle.
+ * @param cfg    [out] Configuration.
+ * @return MC1081_Status_t Operation status code.
+ */
+extern MC1081_Status_t MC1081_DeviceConfigGet(MC1081_Handle_t handle, MC1081_DeviceConfig_t *cfg);
+
+/**
+ * @brief Encodes a configuration into the register values of 0x1C ~ 0x26.
+ * @param cfg  [in]  Configuration.
+ * @param regs [out] MC1081_CFG_REG_NUM register values, 0x1C first.
+ */
+extern void MC1081_DeviceConfigEncode(const MC1081_DeviceConfig_t *cfg, uint8_t *regs);
+
+/**
+ * @brief Decodes the register values of 0x1C ~ 0x26.
+ * @param regs [in]  MC1081_CFG_REG_NUM register values, 0x1C first.
+ * @param cfg  [out] Configuration.
+ */
+extern void MC1081_DeviceConfigDecode(const uint8_t *regs, MC1081_DeviceConfig_t *cfg);
+
+/**
+ * @brief Writes only the registers of cfg that differ from the handle's shadow copy.
+ * @note  Adjacent changed registers go out as one burst, and runs separated by at most
+ *        MC1081_CFG_MERGE_GAP unchanged registers are merged. T_CMD / C_CMD are written
+ *        last. Registers never written or read count as changed; the shadow is compared
+ *        after one decode / encode pass, so reserved bits read back by MC1081_SyncShadow()
+ *        do not make a register changed. An unchanged C_CMD is not rewritten, so use
+ *        MC1081_CapMeasureSet() to trigger another single shot.
+ * @param handle  [in]  Device handle.
+ * @param cfg     [in]  Configuration.
+ * @param skipped [out] Number of registers not written, may be NULL.
+ * @return MC1081_Status_t Operation status code.
+ */
+extern MC1081_Status_t MC1081_DeviceConfigUpdate(MC1081_Handle_t handle, const MC1081_DeviceConfig_t *cfg, uint8_t *skipped);
+
+/**
+ * @brief Writes the changed registers of an encoded configuration block, as MC1081_DeviceConfigUpdate() does.
+ * @param handle  [in]  Device handle.
+ * @param regs    [in]  MC1081_CFG_REG_NUM register values, 0x1C first.
+ * @param skipped [out] Number of registers not written, may be NULL.
+ * @return MC1081_Status_t Operation status code.
+ */
+extern MC1081_Status_t MC1081_DeviceConfigUpdateRegs(MC1081_Handle_t handle, const uint8_t *regs, uint8_t *skipped);
+
+/**
+ * @brief Appends a processing stage to the handle's frame pipeline.
+ * @note Stages run in attach order on every frame returned by MC1081_ReadSnapshot(),
+ *       MC1081_ScanRead(), MC1081_AcquireWhenReady() / MC1081_AcquireFinish(), MC1081_AcquireToRing() and
+ *       MC1081_ASYNC_SNAPSHOT (the latter from the completion context). The node must outlive the attachment.
+ * @param handle [in] Device handle.
+ * @param stage  [in] Caller-owned node.
+ * @param fn     [in] Stage function.
+ * @param ctx    [in] Context passed to fn.
+ * @return MC1081_Status_t MC1081_PARAM_ERR if the node is already attached.
+ */
+extern MC1081_Status_t MC1081_StageAttach(MC1081_Handle_t handle, MC1081_Stage_t *stage, MC1081_StageFunc_t fn, void *ctx);
+
+/**
+ * @brief Removes a processing stage from the handle's frame pipeline.
+ * @param handle [in] Device handle.
+ * @param stage  [in] Node given to MC1081_StageAttach().
+ * @return MC1081_Status_t MC1081_PARAM_ERR if the node is not attached.
+ */
+extern MC1081_Status_t MC1081_StageDetach(MC1081_Handle_t handle, MC1081_Stage_t *stage);
+
+/**
+ * @brief Attaches a non-blocking bus used by the MC1081_Async* functions.
+ * @param handle [in] Device handle.
+ * @param bus    [in] Non-blocking bus interface, copied into the handle.
+ * @return MC1081_Status_t Operation status code.
+ */
+extern MC1081_Status_t MC1081_AsyncAttach(MC1081_Handle_t handle, const MC1081_AsyncBus_t *bus);
+
+/**
+ * @brief Starts a non-blocking read and returns at once.
+ * @note One request per handle may be in flight. Completion is driven by the
+ *       transport calling MC1081_AsyncOnComplete() once per started transfer.
+ * @param handle [in]  Device handle.
+ * @param kind   [in]  What to read.
+ * @param ch     [in]  Channel index for MC1081_ASYNC_CHANNEL / MC1081_ASYNC_MCH, ignored otherwise.
+ * @param out    [out] Snapshot receiving the decoded fields, must stay valid until completion.
+ * @param done   [in]  Completion callback, may be NULL.
+ * @param user   [in]  User pointer passed to `done`.
+ * @param token  [out] Request token for MC1081_AsyncPoll(), may be NULL.
+ * @return MC1081_Status_t MC1081_BUSY_ERR if a request is still in flight.
+ */
+extern MC1081_Status_t MC1081_AsyncStart(MC1081_Handle_t handle, MC1081_AsyncKind_t kind, uint8_t ch,
+                                         MC1081_Snapshot_t *out, MC1081_AsyncDoneFunc_t done, void *user, uint32_t *token);
+
+/**
+ * @brief Advances the request state machine, call from the transport's transfer complete context.
+ * @param handle [in] Device handle.
+ * @note Asynchronous transfers are not retried; a failure finishes the request with the
+ *       phase of the failure when the transport reports one (MC1081_BUS_*).
+ * @param result [in] 0 if the transfer succeeded, non-zero otherwise.
+ */
+extern void MC1081_AsyncOnComplete(MC1081_Handle_t handle, int result);
+
+/**
+ * @brief Gets the state of a request.
+ * @param handle [in] Device handle.
+ * @param token  [in] Token returned by MC1081_AsyncStart().
+ * @return MC1081_Status_t MC1081_BUSY_ERR while in flight, the request's result afterwards,
+ *         MC1081_PARAM_ERR for an unknown or superseded token.
+ */
+extern MC1081_Status_t MC1081_AsyncPoll(MC1081_Handle_t handle, uint32_t token);
+
+/**
+ * @brief Sets the clock that timestamps every frame read.
+ * @note Each snapshot read records the time before its first transfer, after its last
+ *       transfer and an estimate of when the conversion behind the data ended (see
+ *       MC1081_FrameTime_t). The estimate uses the frame period from the last
+ *       MC1081_AcquireBegin(): the middle of the period before the request in
+ *       continuous / periodic mode, the predicted end (bounded by the confirming reads)
+ *       for MC1081_AcquireWhenReady() single shots. With MC1081_ASYNC_SNAPSHOT the clock
+ *       is also called from the completion context.
+ * @param handle [in] Device handle.
+ * @param clock  [in] Monotonic ns clock, NULL to stop timestamping.
+ * @param ctx    [in] Context passed to clock.
+ * @return MC1081_Status_t Operation status code.
+ */
+extern MC1081_Status_t MC1081_SetClock(MC1081_Handle_t handle, MC1081_ClockFunc_t clock, void *ctx);
+
+/**
+ * @brief Gets the times of the last snapshot read, including frames dropped by a stage.
+ * @param handle [in]  Device handle.
+ * @param time   [out] Times, all 0 without a clock.
+ * @return MC1081_Status_t Operation status code.
+ */
+extern MC1081_Status_t MC1081_LastFrameTime(MC1081_Handle_t handle, MC1081_FrameTime_t *time);
+
+/**
+ * @brief Reads a timestamped frame.
+ * @param handle [in]  Device handle.
+ * @param plan   [in]  Scan plan for MC1081_ScanRead(), NULL for MC1081_ReadSnapshot().
+ * @param frame  [out] Frame; timestamp is the bus completion time.
+ * @return MC1081_Status_t Operation status code, the frame is timestamped on MC1081_DROP_ERR too.
+ */
+extern MC1081_Status_t MC1081_ReadFrame(MC1081_Handle_t handle, const MC1081_ScanPlan_t *plan, MC1081_Frame_t *frame);
+
+/**
+ * @brief Sets how failed register operations are retried.
+ * @note Every blocking register write or read is retried as a whole: a failed read
+ *       re-sends its register pointer first. Waits between attempts double from
+ *       backoff_us up to backoff_max_us and need a Delay function. op_timeout_us and the
+ *       deadline need a clock (MC1081_SetClock()); no retry is started that would end
+ *       past them, and the earlier of the two is passed to the bus Deadline function.
+ * @param handle [in] Device handle.
+ * @param policy [in] Policy, copied into the handle; NULL for no retries and no timeout.
+ * @return MC1081_Status_t Operation status code.
+ */
+extern MC1081_Status_t MC1081_SetRetryPolicy(MC1081_Handle_t handle, const MC1081_RetryPolicy_t *policy);
+
+/**
+ * @brief Sets an absolute deadline for all following operations.
+ * @note Operations started after the deadline fail at once with MC1081_TIMEOUT_ERR. Set it
+ *       per frame to bound the frame's tail latency, e.g. request time + frame budget.
+ * @param handle      [in] Device handle.
+ * @param deadline_ns [in] Deadline on the clock of MC1081_SetClock(), 0 for none.
+ * @return MC1081_Status_t Operation status code.
+ */
+extern MC1081_Status_t MC1081_SetDeadline(MC1081_Handle_t handle, uint64_t deadline_ns);
+
+/**
+ * @brief Copies the statistics of a handle.
+ * @note Counters are updated by every transfer, frame and stage drop; histograms only while
+ *       a clock is set. Asynchronous requests update them from the completion context, so
+ *       take the copy while no request is pending for an exact snapshot.
+ * @param handle [in]  Device handle.
+ * @param stats  [out] Statistics, zeroed when MC1081_USE_STATS is 0.
+ * @return MC1081_Status_t MC1081_ERR when statistics are compiled out.
+ */
+extern MC1081_Status_t MC1081_StatsGet(MC1081_Handle_t handle, MC1081_Stats_t *stats);
+
+/**
+ * @brief Clears the statistics of a handle.
+ * @param handle [in] Device handle.
+ * @return MC1081_Status_t MC1081_ERR when statistics are compiled out.
+ */
+extern MC1081_Status_t MC1081_StatsReset(MC1081_Handle_t handle);
+
+/**
+ * @brief Adds one sample to a latency histogram.
+ * @param hist [in] Histogram, zeroed before the first sample.
+ * @param ns   [in] Sample, clamped to UINT32_MAX.
+ */
+extern void MC1081_LatHistAdd(MC1081_LatHist_t *hist, uint64_t ns);
+
+/**
+ * @brief Percentile of a latency histogram.
+ * @param hist     [in] Histogram.
+ * @param permille [in] Rank, 0 ~ 1000 (999 is the 99.9th percentile).
+ * @return Upper edge of the bucket holding the percentile (never above the largest sample), 0 without samples.
+ */
+extern uint32_t MC1081_LatHistPercentile(const MC1081_LatHist_t *hist, uint16_t permille);
+
+/**
+ * @brief Percentile of one operation class from a statistics copy.
+ * @param stats    [in] Statistics from MC1081_StatsGet().
+ * @param op       [in] Operation class.
+ * @param permille [in] Rank, 0 ~ 1000.
+ * @return MC1081_LatHistPercentile() of the class's histogram, in ns.
+ */
+extern uint32_t MC1081_StatsPercentile(const MC1081_Stats_t *stats, MC1081_OpClass_t op, uint16_t permille);
+
+/**
+ * @brief Sets the reference clock frequency used by the conversion time predictor.
+ * @param handle  [in] Device handle.
+ * @param fref_hz [in] Reference clock in Hz (default MC1081_FREF_HZ).
+ * @return MC1081_Status_t Operation status code.
+ */
+extern MC1081_Status_t MC1081_SetRefClock(MC1081_Handle_t handle, uint32_t fref_hz);
+
+/**
+ * @brief Predicts how long one conversion frame takes with the current configuration.
+ * @note Uses C_CMD (CAVG, mode), DIV_CFG, the FIN cycle count N, the enabled channels and
+ *       T_CMD. Each channel's time is derived from its last count when `last` holds one,
+ *       otherwise from MC1081_FIN_NOMINAL_HZ. MC1081_PREDICT_MARGIN_PCT is added.
+ *       Only predicts: the handle is left unchanged.
+ * @param handle [in]  Device handle.
+ * @param last   [in]  Previous frame of the same configuration, may be NULL.
+ * @param us     [out] Predicted frame time in microseconds.
+ * @return MC1081_Status_t Operation status code.
+ */
+extern MC1081_Status_t MC1081_PredictFrameTime(MC1081_Handle_t handle, const MC1081_Snapshot_t *last, uint32_t *us);
+
+/**
+ * @brief Sleeps until the next frame is ready, then reads it with one burst.
+ * @note Single-shot / stopped mode: starts a single conversion, sleeps for the predicted
+ *       time and reads the snapshot, whose STATUS byte confirms completion (FLAG_CCVT, and
+ *       FLAG_TCVT while T_CMD STC is set, so temperature belongs to the same frame). Only a
+ *       short prediction costs extra reads (at most MC1081_ACQ_MAX_RETRY, doubling back-off).
+ *       Periodic mode: sleeps until one interval (at least one frame time) after the
+ *       request of the previous read, whose data ended no later; a full interval without
+ *       a clock (MC1081_SetClock()) or a previous read. Requires the bus Delay callback.
+ * @param handle [in]  Device handle.
+ * @param last   [in]  Previous frame used to refine the prediction, may be NULL or equal to `snap`.
+ * @param snap   [out] New frame.
+ * @return MC1081_Status_t MC1081_BUSY_ERR if the conversion did not finish in time.
+ */
+extern MC1081_Status_t MC1081_AcquireWhenReady(MC1081_Handle_t handle, const MC1081_Snapshot_t *last, MC1081_Snapshot_t *snap);
+
+/**
+ * @brief First half of MC1081_AcquireWhenReady(): starts the frame and returns without sleeping.
+ * @note Single-shot / stopped mode starts a single conversion, periodic mode only predicts the
+ *       wait. Stores the frame period used by the frame timestamps. Callers driving several devices start them all, then finish each once its wait
+ *       has passed, so one chip converts while another is read.
+ * @param handle  [in]  Device handle.
+ * @param last    [in]  Previous frame used to refine the prediction, may be NULL.
+ * @param wait_us [out] Time to wait before MC1081_AcquireFinish(), from the return of this call.
+ * @return MC1081_Status_t MC1081_ERR without a bus Delay callback.
+ */
+extern MC1081_Status_t MC1081_AcquireBegin(MC1081_Handle_t handle, const MC1081_Snapshot_t *last, uint32_t *wait_us);
+
+/**
+ * @brief Second half of MC1081_AcquireWhenReady(): reads the frame started by MC1081_AcquireBegin().
+ * @note Polls with a doubling back-off while STATUS still shows the single shot busy.
+ *       The frame is timestamped and runs through the attached stages.
+ * @param handle [in]  Device handle.
+ * @param plan   [in]  Scan plan, NULL for the whole result block. In single-shot mode it must
+ *                     include MC1081_SCAN_FLAGS.
+ * @param snap   [out] New frame.
+ * @return MC1081_Status_t MC1081_ERR if no acquisition was begun, MC1081_BUSY_ERR if the
+ *         conversion did not finish in time.
+ */
+extern MC1081_Status_t MC1081_AcquireFinish(MC1081_Handle_t handle, const MC1081_ScanPlan_t *plan, MC1081_Snapshot_t *snap);
+
 /**
  * @brief Calculates the I2C address based on hardware ADDR pin strapping.
  * @note For MC1081L, the address is fixed to MC1081_DEFAULT_I2CADDR.
@@ -273,9 +636,9 @@ extern MC1081_Status_t MC1081_SoftWareReset(MC1081_Handle_t handle);
 extern uint8_t MC1081_CalI2cAddr(MC1081_AddrSel_t add);
 
 /**
- * @brief De-initializes the device and releases allocated instance memory.
+ * @brief De-initializes the device and releases the instance (heap, pool or static storage).
  * @param handle [in/out] Pointer to the device handle to be cleared.
- * @return MC1081_Status_t Operation status code.
+ * @return MC1081_Status_t MC1081_PARAM_ERR if pool or static storage was already released.
  */
 extern MC1081_Status_t MC1081_DeInit(MC1081_Handle_t *handle);
 
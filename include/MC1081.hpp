@@ -0,0 +1,459 @@
+/**
+ * @file MC1081.hpp
+ * @author https://github.com/xfp23
+ * @brief Header-only C++17 interface with compile-time register encoding.
+ * @version 0.1
+ * @date 2026-02-05
+ *
+ * @copyright Copyright (c) 2026
+ *
+ * A thin layer over the C driver for C++ users:
+ * - MC1081::Config holds a whole configuration as plain values and encodes
+ *   it into the register image of 0x1C ~ 0x26 in a constant expression.
+ * - MC1081::Profile<Cfg> checks a configuration with static_assert (reserved
+ *   start mode, N = 0, values out of range, conversion without an enabled
+ *   channel) and keeps its image, so applying it copies a constant buffer.
+ * - MC1081::Channel<Kind, N> names a channel by type. An index out of range
+ *   does not compile, and MC1081::Sensor<Cfg> also rejects channels that are
+ *   disabled or not measured in the configured oscillator mode.
+ * - MC1081::Device owns a handle (RAII, move-only). Errors are returned as
+ *   MC1081_Status_t as in C; nothing throws.
+ *
+ * The C sources are compiled as C and linked as usual, MC1081.h declares
+ * them extern "C".
+ *
+ *   static constexpr MC1081::Config kCfg = MC1081::Config{}
+ *       .Cap({MC1081_CAP_OSC_SINGLE, MC1081_CAP_TIME_CONT, MC1081_CAP_AVG_4,
+ *             MC1081_CHIP_SLEEP_OFF, MC1081_CAP_START_PERIODIC})
+ *       .Clock({MC1081_FINDIV_4, MC1081_FREFDIV_1, MC1081_FIN_BUILD_4_CYCLE})
+ *       .FinCycle(32)
+ *       .Enable<MC1081::Channel<MC1081::Single, 0>, MC1081::Channel<MC1081::Single, 3>>();
+ *
+ *   MC1081::Sensor<kCfg> sensor(bus);
+ *   sensor.Configure();
+ *   uint16_t raw = 0;
+ *   sensor.Read<MC1081::Channel<MC1081::Single, 3>>(raw);
+ */
+#ifndef __MC1081_HPP__
+#define __MC1081_HPP__
+
+#include "MC1081.h"
+#include "MC1081_reg.h"
+
+#include <array>
+#include <type_traits>
+#include <utility>
+
+#if __cplusplus < 201703L && (!defined(_MSVC_LANG) || _MSVC_LANG < 201703L)
+#error "MC1081.hpp needs C++17"
+#endif
+
+namespace MC1081
+{
+
+/** @brief Register image of 0x1C ~ 0x26, 0x1C first */
+using Image = std::array<uint8_t, MC1081_CFG_REG_NUM>;
+
+/** @brief Single-ended channels 0 ~ 9 and REF (10), measured on OSC1 */
+struct Single
+{
+    static constexpr unsigned count = MC1081_DCH_SING_REF + 1;
+    static constexpr MC1081_CapOscMode_t mode = MC1081_CAP_OSC_SINGLE;
+};
+
+/** @brief Differential channels 0 ~ 4 and REF (5), measured on OSC2 */
+struct Diff
+{
+    static constexpr unsigned count = MC1081_DCH_DIFF_REF + 1;
+    static constexpr MC1081_CapOscMode_t mode = MC1081_CAP_OSC_DIFF;
+};
+
+/** @brief Mutual capacitance channels 0 ~ 4, measured on OSC1 */
+struct Mutual
+{
+    static constexpr unsigned count = MC1081_MCH_NUM;
+    static constexpr MC1081_CapOscMode_t mode = MC1081_CAP_OSC_SINGLE;
+};
+
+/**
+ * @brief A channel named by type
+ * @tparam Kind MC1081::Single, MC1081::Diff or MC1081::Mutual.
+ * @tparam N    Index within the kind, REF included.
+ */
+template <typename Kind, unsigned N>
+struct Channel
+{
+    static_assert(std::is_same_v<Kind, Single> || std::is_same_v<Kind, Diff> || std::is_same_v<Kind, Mutual>,
+                  "Channel kind must be MC1081::Single, MC1081::Diff or MC1081::Mutual");
+    static_assert(N < Kind::count, "Channel index out of range for its kind");
+
+    using kind = Kind;
+    static constexpr unsigned index = N;
+    static constexpr uint16_t bit = static_cast<uint16_t>(1U << N); /**< Bit in the kind's enable register */
+
+    /** @brief Count of this channel in a snapshot */
+    static constexpr uint16_t From(const MC1081_Snapshot_t &snap) noexcept
+    {
+        if constexpr (std::is_same_v<Kind, Mutual>)
+            return snap.mch[N];
+        else
+            return snap.ch[N];
+    }
+
+    /** @brief Overflow bit of this channel in a snapshot */
+    static constexpr bool Overflow(const MC1081_Snapshot_t &snap) noexcept
+    {
+        if constexpr (std::is_same_v<Kind, Diff>)
+            return (snap.of_diff & bit) != 0;
+        else if constexpr (std::is_same_v<Kind, Mutual>)
+            return (snap.of_single & (1U << (MC1081_CH_NUM + N))) != 0;
+        else
+            return (snap.of_single & bit) != 0;
+    }
+};
+
+/**
+ * @brief Whole configuration as plain values, usable in constant expressions
+ *
+ * Mirrors MC1081_DeviceConfig_t with the enable registers as integers, since a
+ * union member cannot be chosen in a constant expression.
+ */
+struct Config
+{
+    MC1081_TempConvState_t temp_state = MC1081_TEMP_CONV_OFF;
+    MC1081_TempTime_t temp_time = MC1081_TEMP_TIME_0P3_MS;
+    MC1081_CapConvConfig_t cap = {MC1081_CAP_OSC_SINGLE, MC1081_CAP_TIME_CONT, MC1081_CAP_AVG_1,
+                                  MC1081_CHIP_SLEEP_OFF, MC1081_CAP_START_STOP};
+    uint8_t fin_cycle = 1;
+    MC1081_ClockCfg_t clock = {MC1081_FINDIV_1, MC1081_FREFDIV_1, MC1081_FIN_BUILD_1_CYCLE};
+    uint16_t ch_single = 0; /**< Bit n: single-ended channel n, bit 10 REF */
+    uint8_t mch = 0;        /**< Bit n: mutual channel n */
+    MC1081_SingleOSCCfg_t osc1 = {MC1081_DRCU_16UA, MC1081_AMPOS1_1_2, MC1081_PWR_HIGH};
+    uint8_t ch_diff = 0;    /**< Bit n: differential channel n, bit 5 REF */
+    MC1081_DiffOSCCfg_t osc2 = {MC1081_DRCU_16UA, MC1081_AMPOS2_1_2, MC1081_PWR_HIGH};
+    MC1081_ActiveShielCfg shield = {MC1081_ACTIVE_SHIELD_OFF, MC1081_SHIELD_PWR_LOW, MC1081_SHIELD_HIGHRES};
+
+    constexpr Config Temp(MC1081_TempConvState_t state, MC1081_TempTime_t time) const noexcept
+    {
+        Config c = *this;
+        c.temp_state = state;
+        c.temp_time = time;
+        return c;
+    }
+
+    constexpr Config Cap(MC1081_CapConvConfig_t v) const noexcept
+    {
+        Config c = *this;
+        c.cap = v;
+        return c;
+    }
+
+    constexpr Config Clock(MC1081_ClockCfg_t v) const noexcept
+    {
+        Config c = *this;
+        c.clock = v;
+        return c;
+    }
+
+    constexpr Config FinCycle(uint8_t n) const noexcept
+    {
+        Config c = *this;
+        c.fin_cycle = n;
+        return c;
+    }
+
+    constexpr Config Osc1(MC1081_SingleOSCCfg_t v) const noexcept
+    {
+        Config c = *this;
+        c.osc1 = v;
+        return c;
+    }
+
+    constexpr Config Osc2(MC1081_DiffOSCCfg_t v) const noexcept
+    {
+        Config c = *this;
+        c.osc2 = v;
+        return c;
+    }
+
+    constexpr Config Shield(MC1081_ActiveShielCfg v) const noexcept
+    {
+        Config c = *this;
+        c.shield = v;
+        return c;
+    }
+
+    /** @brief Enables channels given as MC1081::Channel types */
+    template <typename... Ch>
+    constexpr Config Enable() const noexcept
+    {
+        Config c = *this;
+        (c.SetEnable<Ch>(true), ...);
+        return c;
+    }
+
+    /** @brief Disables channels given as MC1081::Channel types */
+    template <typename... Ch>
+    constexpr Config Disable() const noexcept
+    {
+        Config c = *this;
+        (c.SetEnable<Ch>(false), ...);
+        return c;
+    }
+
+    /** @brief Whether a channel is enabled */
+    template <typename Ch>
+    constexpr bool Enabled() const noexcept
+    {
+        if constexpr (std::is_same_v<typename Ch::kind, Single>)
+            return (ch_single & Ch::bit) != 0;
+        else if constexpr (std::is_same_v<typename Ch::kind, Diff>)
+            return (ch_diff & Ch::bit) != 0;
+        else
+            return (mch & Ch::bit) != 0;
+    }
+
+    /** @brief Whether a channel is enabled and measured in the configured oscillator mode */
+    template <typename Ch>
+    constexpr bool Measures() const noexcept
+    {
+        return Enabled<Ch>() && Ch::kind::mode == cap.osc_mode;
+    }
+
+    /** @brief Converts to the C configuration */
+    MC1081_DeviceConfig_t ToC() const noexcept
+    {
+        MC1081_DeviceConfig_t c = {};
+        c.temp_state = temp_state;
+        c.temp_time = temp_time;
+        c.cap = cap;
+        c.fin_cycle = fin_cycle;
+        c.clock = clock;
+        c.ch_single.value = ch_single;
+        c.mch.value = mch;
+        c.osc1 = osc1;
+        c.ch_diff.value = ch_diff;
+        c.osc2 = osc2;
+        c.shield = shield;
+        return c;
+    }
+
+private:
+    template <typename Ch>
+    constexpr void SetEnable(bool on) noexcept
+    {
+        if constexpr (std::is_same_v<typename Ch::kind, Single>)
+            ch_single = static_cast<uint16_t>(on ? (ch_single | Ch::bit) : (ch_single & ~Ch::bit));
+        else if constexpr (std::is_same_v<typename Ch::kind, Diff>)
+            ch_diff = static_cast<uint8_t>(on ? (ch_diff | Ch::bit) : (ch_diff & ~Ch::bit));
+        else
+            mch = static_cast<uint8_t>(on ? (mch | Ch::bit) : (mch & ~Ch::bit));
+    }
+};
+
+/* Register encoders, bit positions as in MC1081_reg.h */
+
+constexpr uint8_t EncodeTCmd(MC1081_TempConvState_t state, MC1081_TempTime_t time) noexcept
+{
+    return static_cast<uint8_t>((state & 0x01U) | ((time & 0x01U) << 7));
+}
+
+constexpr uint8_t EncodeCCmd(const MC1081_CapConvConfig_t &cap) noexcept
+{
+    return static_cast<uint8_t>((cap.start & 0x03U) | ((cap.interval & 0x03U) << 2) | ((cap.avg_cycle & 0x03U) << 4) |
+                                ((cap.sleep & 0x01U) << 6) | ((cap.osc_mode & 0x01U) << 7));
+}
+
+constexpr uint8_t EncodeDivCfg(const MC1081_ClockCfg_t &clk) noexcept
+{
+    return static_cast<uint8_t>((clk.fref_div & 0x03U) | ((clk.fin_div & 0x07U) << 4) | ((clk.fin_build & 0x01U) << 7));
+}
+
+constexpr uint8_t EncodeOsc1(const MC1081_SingleOSCCfg_t &osc) noexcept
+{
+    return static_cast<uint8_t>((osc.dr_cu & 0x0FU) | ((osc.amplitude & 0x07U) << 4) | ((osc.ldo & 0x01U) << 7));
+}
+
+constexpr uint8_t EncodeOsc2(const MC1081_DiffOSCCfg_t &osc) noexcept
+{
+    return static_cast<uint8_t>((osc.dr_cu & 0x0FU) | ((osc.amplitude & 0x07U) << 4) | ((osc.ldo & 0x01U) << 7));
+}
+
+constexpr uint8_t EncodeShield(const MC1081_ActiveShielCfg &shld) noexcept
+{
+    return static_cast<uint8_t>((shld.en & 0x01U) | ((shld.pwr & 0x01U) << 1) | ((shld.sel & 0x03U) << 6));
+}
+
+/** @brief Encodes a configuration, same result as MC1081_DeviceConfigEncode() */
+constexpr Image Encode(const Config &cfg) noexcept
+{
+    Image r = {};
+    r[MC1081_REG_T_CMD - MC1081_REG_T_CMD] = EncodeTCmd(cfg.temp_state, cfg.temp_time);
+    r[MC1081_REG_C_CMD - MC1081_REG_T_CMD] = EncodeCCmd(cfg.cap);
+    r[MC1081_REG_FIN_CNT - MC1081_REG_T_CMD] = cfg.fin_cycle;
+    r[MC1081_REG_DIV_CFG - MC1081_REG_T_CMD] = EncodeDivCfg(cfg.clock);
+    r[MC1081_REG_OSC1_CHS - MC1081_REG_T_CMD] = static_cast<uint8_t>(cfg.ch_single & 0xFFU);
+    r[MC1081_REG_OSC1_CHS - MC1081_REG_T_CMD + 1] = static_cast<uint8_t>(cfg.ch_single >> 8);
+    r[MC1081_REG_OSC1_MCHS - MC1081_REG_T_CMD] = cfg.mch;
+    r[MC1081_REG_OSC1_CFG - MC1081_REG_T_CMD] = EncodeOsc1(cfg.osc1);
+    r[MC1081_REG_OSC2_DCHS - MC1081_REG_T_CMD] = cfg.ch_diff;
+    r[MC1081_REG_OSC2_CFG - MC1081_REG_T_CMD] = EncodeOsc2(cfg.osc2);
+    r[MC1081_REG_SHLD_CFG - MC1081_REG_T_CMD] = EncodeShield(cfg.shield);
+    return r;
+}
+
+/**
+ * @brief A configuration checked and encoded at compile time
+ * @tparam Cfg Configuration with static storage, e.g. `static constexpr MC1081::Config`.
+ */
+template <const Config &Cfg>
+struct Profile
+{
+    static_assert(Cfg.cap.start != MC1081_CAP_START_RESERVED, "C_CMD start mode 1 is reserved");
+    static_assert(Cfg.cap.osc_mode <= MC1081_CAP_OSC_DIFF && Cfg.cap.interval <= MC1081_CAP_TIME_CONT &&
+                      Cfg.cap.avg_cycle <= MC1081_CAP_AVG_32 && Cfg.cap.start <= MC1081_CAP_START_SINGLE,
+                  "Capacitance conversion setting out of range");
+    static_assert(Cfg.fin_cycle != 0, "FIN cycle count N must not be 0");
+    static_assert(Cfg.clock.fin_div <= MC1081_FINDIV_64 && Cfg.clock.fref_div <= MC1081_FREFDIV_8,
+                  "Clock divider out of range");
+    static_assert(Cfg.osc1.dr_cu <= MC1081_DRCU_2000UA && Cfg.osc2.dr_cu <= MC1081_DRCU_2000UA,
+                  "Driver current out of range");
+    static_assert(Cfg.osc2.amplitude <= MC1081_AMPOS2_2_4, "OSC2 amplitude out of range");
+    static_assert((Cfg.ch_single >> Single::count) == 0 && (Cfg.ch_diff >> Diff::count) == 0 &&
+                      (Cfg.mch >> Mutual::count) == 0,
+                  "Reserved channel enable bit set");
+    static_assert(Cfg.cap.start == MC1081_CAP_START_STOP ||
+                      (Cfg.cap.osc_mode == MC1081_CAP_OSC_DIFF ? Cfg.ch_diff != 0 : (Cfg.ch_single | Cfg.mch) != 0),
+                  "Conversion started without an enabled channel of the selected oscillator mode");
+
+    static constexpr Image regs = Encode(Cfg); /**< Register image */
+};
+
+/**
+ * @brief Owner of a driver handle
+ *
+ * Constructing it initializes the handle with MC1081_InitBus(), destroying it
+ * releases the handle. Check the result with status() or operator bool.
+ */
+class Device
+{
+public:
+    Device() noexcept = default;
+
+    explicit Device(const MC1081_Bus_t &bus, uint8_t addr = MC1081_DEFAULT_I2CADDR) noexcept
+        : status_(MC1081_InitBus(&handle_, &bus, addr))
+    {
+    }
+
+    ~Device()
+    {
+        if (handle_ != nullptr)
+            MC1081_DeInit(&handle_);
+    }
+
+    Device(const Device &) = delete;
+    Device &operator=(const Device &) = delete;
+
+    Device(Device &&other) noexcept
+        : handle_(std::exchange(other.handle_, nullptr)), status_(std::exchange(other.status_, MC1081_ERR))
+    {
+    }
+
+    Device &operator=(Device &&other) noexcept
+    {
+        if (this != &other)
+        {
+            if (handle_ != nullptr)
+                MC1081_DeInit(&handle_);
+            handle_ = std::exchange(other.handle_, nullptr);
+            status_ = std::exchange(other.status_, MC1081_ERR);
+        }
+        return *this;
+    }
+
+    explicit operator bool() const noexcept { return handle_ != nullptr; }
+
+    /** @brief Result of the initialization */
+    MC1081_Status_t status() const noexcept { return status_; }
+
+    /** @brief Handle for the C API */
+    MC1081_Handle_t get() const noexcept { return handle_; }
+
+    /** @brief Writes a configuration encoded at compile time, see MC1081_DeviceConfigApplyRegs() */
+    template <const Config &Cfg>
+    MC1081_Status_t Apply() noexcept
+    {
+        return MC1081_DeviceConfigApplyRegs(handle_, Profile<Cfg>::regs.data());
+    }
+
+    /** @brief Writes the changed registers of a configuration encoded at compile time */
+    template <const Config &Cfg>
+    MC1081_Status_t Update(uint8_t *skipped = nullptr) noexcept
+    {
+        return MC1081_DeviceConfigUpdateRegs(handle_, Profile<Cfg>::regs.data(), skipped);
+    }
+
+    /** @brief Writes a configuration built at run time */
+    MC1081_Status_t Apply(const Config &cfg) noexcept
+    {
+        const Image regs = Encode(cfg);
+        return MC1081_DeviceConfigApplyRegs(handle_, regs.data());
+    }
+
+    /** @brief Reads all results, see MC1081_ReadSnapshot() */
+    MC1081_Status_t Read(MC1081_Snapshot_t &snap) noexcept { return MC1081_ReadSnapshot(handle_, &snap); }
+
+    /** @brief Reads one channel */
+    template <typename Ch>
+    MC1081_Status_t Read(uint16_t &raw) noexcept
+    {
+        if constexpr (std::is_same_v<typename Ch::kind, Single>)
+            return MC1081_GetSigleCHxRaw(handle_, static_cast<MC1081_Channel_Single_t>(Ch::index), &raw);
+        else if constexpr (std::is_same_v<typename Ch::kind, Diff>)
+            return MC1081_GetDiffDCHxRaw(handle_, static_cast<MC1081_Channel_Diff_t>(Ch::index), &raw);
+        else
+            return MC1081_GetMCHxRaw(handle_, static_cast<MC1081_Channel_MCH_t>(Ch::index), &raw);
+    }
+
+private:
+    MC1081_Handle_t handle_ = nullptr;
+    MC1081_Status_t status_ = MC1081_ERR;
+};
+
+/**
+ * @brief Device bound to a compile-time configuration
+ *
+ * Reading a channel that Cfg does not enable, or that belongs to the other
+ * oscillator mode, does not compile.
+ */
+template <const Config &Cfg>
+class Sensor : public Device
+{
+public:
+    using Device::Device;
+    using Device::Read;
+
+    /** @brief Writes Cfg */
+    MC1081_Status_t Configure() noexcept { return Apply<Cfg>(); }
+
+    template <typename Ch>
+    MC1081_Status_t Read(uint16_t &raw) noexcept
+    {
+        static_assert(Cfg.template Measures<Ch>(), "Channel not enabled or not measured in the configured oscillator mode");
+        return Device::Read<Ch>(raw);
+    }
+
+    /** @brief Count of a channel in a snapshot */
+    template <typename Ch>
+    static constexpr uint16_t Get(const MC1081_Snapshot_t &snap) noexcept
+    {
+        static_assert(Cfg.template Measures<Ch>(), "Channel not enabled or not measured in the configured oscillator mode");
+        return Ch::From(snap);
+    }
+
+    static constexpr const Image &regs = Profile<Cfg>::regs; /**< Register image of Cfg */
+};
+
+} // namespace MC1081
+
+#endif
@@ -0,0 +1,209 @@
+/**
+ * @file MC1081_conv.h
+ * @author https://github.com/xfp23
+ * @brief Fixed-point conversion of raw counts to capacitance.
+ * @version 0.1
+ * @date 2026-02-05
+ *
+ * @copyright Copyright (c) 2026
+ *
+ * A count is the number of divided reference clock periods that elapse during
+ * N * 2^FINDIV oscillator periods, and the oscillator runs at
+ * f_in = I_osc / (2 * C * V_osc). The capacitance is therefore linear in the
+ * count:
+ *
+ *   C = count * I_osc * 2^FREFDIV / (2 * V_osc * N * 2^FINDIV * f_ref)
+ *
+ * The factor is computed once per configuration as a 32-bit mantissa and a
+ * shift; converting a count then takes one 32x16 multiply, a rounding add and
+ * a shift. Results are in fF (0.001 pF).
+ *
+ * Temperature words are two's complement, 1/256 °C per LSB around 40 °C:
+ *
+ *   T = 40 + (int16_t)raw / 256   °C
+ *
+ * MC1081_TempCal_t trims gain and offset of that line from one or two known
+ * temperatures. Temperatures are in m°C.
+ */
+#ifndef __MC1081_CONV_H__
+#define __MC1081_CONV_H__
+
+#include "MC1081.h"
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/** @brief Supply voltage assumed for the VDD relative OS1 amplitudes, mV */
+#ifndef MC1081_CONV_VDD_MV
+#define MC1081_CONV_VDD_MV (3300U)
+#endif
+
+/** @brief Value returned for a saturated (overflowed) count */
+#define MC1081_CONV_OVERFLOW (INT32_MAX)
+
+/**
+ * @brief Precomputed conversion for one configuration
+ */
+typedef struct
+{
+    /* 转换热路径只使用以下字段 */
+    uint32_t mant;   /**< fF per count = mant / 2^shift */
+    uint8_t shift;   /**< Fraction bits of mant */
+    int32_t cpar_ff; /**< Parasitic capacitance subtracted from every result, fF */
+
+    uint32_t fref_hz; /**< Reference clock */
+    uint16_t vdd_mv;  /**< Supply voltage for the VDD relative OS1 amplitudes */
+    uint8_t osc_sel;  /**< MC1081_CapOscMode_t the factor was computed for */
+    uint8_t valid;    /**< 1: mant / shift hold a computed factor */
+    uint8_t key[6];   /**< Configuration the factor was computed from, see MC1081_ConvSync() */
+} MC1081_Conv_t;
+
+/** @brief Temperature at raw = 0, m°C */
+#define MC1081_TEMP_ZERO_MC (40000)
+
+/**
+ * @brief Temperature calibration: T = offset_mc + gain * raw * 1000 / 256
+ */
+typedef struct
+{
+    int32_t gain_q16;  /**< Slope relative to the nominal 1/256 °C per LSB, Q16.16 */
+    int32_t offset_mc; /**< Temperature at raw = 0, m°C */
+} MC1081_TempCal_t;
+
+/**
+ * @brief One frame converted to capacitance, fF
+ */
+typedef struct
+{
+    int32_t ch[MC1081_CH_NUM];   /**< Single-ended / differential channels */
+    int32_t mch[MC1081_MCH_NUM]; /**< Mutual channels */
+} MC1081_CapFrame_t;
+
+/**
+ * @brief Initializes a conversion context. No factor is valid until a Setup or Sync call.
+ * @param conv    [out] Context.
+ * @param fref_hz [in]  Reference clock, 0 for MC1081_FREF_HZ.
+ * @param vdd_mv  [in]  Supply voltage, 0 for MC1081_CONV_VDD_MV.
+ */
+extern void MC1081_ConvInit(MC1081_Conv_t *conv, uint32_t fref_hz, uint16_t vdd_mv);
+
+/**
+ * @brief Sets the parasitic capacitance subtracted from every result.
+ * @param conv    [in] Context.
+ * @param cpar_ff [in] Parasitic capacitance, fF.
+ */
+extern void MC1081_ConvSetParasitic(MC1081_Conv_t *conv, int32_t cpar_ff);
+
+/**
+ * @brief Computes the factor for single-ended / mutual measurements.
+ * @param conv      [in] Context.
+ * @param clk       [in] FINDIV / FREFDIV.
+ * @param fin_cycle [in] FIN cycle count N.
+ * @param osc       [in] OS1 current and amplitude.
+ * @return MC1081_Status_t MC1081_PARAM_ERR for an out-of-range setting or a non-positive amplitude.
+ */
+extern MC1081_Status_t MC1081_ConvSetupSingle(MC1081_Conv_t *conv, MC1081_ClockCfg_t clk, uint8_t fin_cycle, MC1081_SingleOSCCfg_t osc);
+
+/**
+ * @brief Computes the factor for differential measurements.
+ * @param conv      [in] Context.
+ * @param clk       [in] FINDIV / FREFDIV.
+ * @param fin_cycle [in] FIN cycle count N.
+ * @param osc       [in] OS2 current and amplitude.
+ * @return MC1081_Status_t MC1081_PARAM_ERR for an out-of-range setting.
+ */
+extern MC1081_Status_t MC1081_ConvSetupDiff(MC1081_Conv_t *conv, MC1081_ClockCfg_t clk, uint8_t fin_cycle, MC1081_DiffOSCCfg_t osc);
+
+/**
+ * @brief Follows the device configuration, recomputing the factor only when it changed.
+ * @note The configuration is read through the handle's shadow registers, so no bus
+ *       transfer happens once they are valid. Call it after any configuration change.
+ * @param handle [in] Device handle.
+ * @param conv   [in] Context.
+ * @return MC1081_Status_t Operation status code.
+ */
+extern MC1081_Status_t MC1081_ConvSync(MC1081_Handle_t handle, MC1081_Conv_t *conv);
+
+/**
+ * @brief Converts one count to capacitance.
+ * @return Capacitance in fF, MC1081_CONV_OVERFLOW for a saturated count.
+ */
+static inline int32_t MC1081_ConvToFf(const MC1081_Conv_t *conv, uint16_t raw)
+{
+    if (raw == 0xFFFF)
+        return MC1081_CONV_OVERFLOW;
+
+    const uint64_t round = (conv->shift != 0) ? (1ULL << (conv->shift - 1)) : 0;
+    int64_t c = (int64_t)((((uint64_t)raw * conv->mant) + round) >> conv->shift) - conv->cpar_ff;
+
+    if (c >= MC1081_CONV_OVERFLOW)
+        c = MC1081_CONV_OVERFLOW - 1;
+    else if (c < INT32_MIN)
+        c = INT32_MIN;
+
+    return (int32_t)c;
+}
+
+/**
+ * @brief Converts an array of counts.
+ * @param conv [in]  Context.
+ * @param raw  [in]  Counts.
+ * @param ff   [out] Capacitance in fF, may not alias raw.
+ * @param n    [in]  Number of counts.
+ */
+extern void MC1081_ConvBatch(const MC1081_Conv_t *conv, const uint16_t *raw, int32_t *ff, size_t n);
+
+/**
+ * @brief Converts every channel of a snapshot.
+ * @note Channels flagged as overflowed in the snapshot read MC1081_CONV_OVERFLOW.
+ * @param conv [in]  Context.
+ * @param snap [in]  Raw frame.
+ * @param out  [out] Converted frame.
+ * @return MC1081_Status_t MC1081_ERR if no factor has been computed.
+ */
+extern MC1081_Status_t MC1081_ConvFrame(const MC1081_Conv_t *conv, const MC1081_Snapshot_t *snap, MC1081_CapFrame_t *out);
+
+/**
+ * @brief Resets a temperature calibration to the nominal transfer function.
+ */
+extern void MC1081_TempCalInit(MC1081_TempCal_t *cal);
+
+/**
+ * @brief One-point calibration: trims the offset so that raw reads t_mc, keeps the slope.
+ * @param cal  [in] Calibration.
+ * @param raw  [in] Raw temperature word measured at the known temperature.
+ * @param t_mc [in] Known temperature, m°C.
+ * @return MC1081_Status_t Operation status code.
+ */
+extern MC1081_Status_t MC1081_TempCalOnePoint(MC1081_TempCal_t *cal, uint16_t raw, int32_t t_mc);
+
+/**
+ * @brief Two-point calibration: slope and offset through two known temperatures.
+ * @return MC1081_Status_t MC1081_PARAM_ERR if the raw words are equal.
+ */
+extern MC1081_Status_t MC1081_TempCalTwoPoint(MC1081_TempCal_t *cal, uint16_t raw_a, int32_t t_a_mc, uint16_t raw_b, int32_t t_b_mc);
+
+/**
+ * @brief Converts a raw temperature word.
+ * @param cal [in] Calibration, NULL for the nominal transfer function.
+ * @param raw [in] Value of MC1081_GetTempRaw() / MC1081_Snapshot_t::temp.
+ * @return Temperature in m°C.
+ */
+extern int32_t MC1081_TempToMilliC(const MC1081_TempCal_t *cal, uint16_t raw);
+
+/**
+ * @brief Reads the temperature in m°C.
+ * @param handle [in]  Device handle.
+ * @param cal    [in]  Calibration, may be NULL.
+ * @param t_mc   [out] Temperature, m°C.
+ * @return MC1081_Status_t Operation status code.
+ */
+extern MC1081_Status_t MC1081_GetTempMilliC(MC1081_Handle_t handle, const MC1081_TempCal_t *cal, int32_t *t_mc);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
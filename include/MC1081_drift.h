@@ -0,0 +1,107 @@
+/**
+ * @file MC1081_drift.h
+ * @author https://github.com/xfp23
+ * @brief On-line temperature drift compensation of channel counts.
+ * @version 0.1
+ * @date 2026-02-05
+ *
+ * @copyright Copyright (c) 2026
+ *
+ * Every channel is modelled as count(T) = count(T0) * (1 + alpha * (T - T0)).
+ * The reference channel (MC1081_DCH_SING_REF / MC1081_DCH_DIFF_REF) sees a
+ * fixed capacitor, so its relative change against the die temperature is pure
+ * drift. Its coefficient alpha_ref is learned by an exponentially weighted
+ * least-squares fit through (T0, ref0), and each channel uses
+ * alpha_ref * scale[ch]. The stage rewrites the counts of every frame to
+ * their value at T0, integer arithmetic only.
+ *
+ * Temperature conversion must be enabled (MC1081_TempConfig()) for the
+ * snapshot to carry a fresh temperature.
+ */
+#ifndef __MC1081_DRIFT_H__
+#define __MC1081_DRIFT_H__
+
+#include "MC1081_conv.h"
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/** @brief Learning window: the fit forgets with a time constant of 2^shift frames */
+#ifndef MC1081_DRIFT_DECAY_SHIFT
+#define MC1081_DRIFT_DECAY_SHIFT (8)
+#endif
+
+/** @brief RMS temperature excursion needed before alpha_ref is trusted, m°C */
+#ifndef MC1081_DRIFT_MIN_SPAN_MC
+#define MC1081_DRIFT_MIN_SPAN_MC (500)
+#endif
+
+/**
+ * @brief Drift compensation state, also the context of its stage
+ */
+typedef struct
+{
+    MC1081_Stage_t stage;        /**< Pipeline node used by MC1081_DriftAttach() */
+    const MC1081_TempCal_t *cal; /**< Temperature calibration, NULL: nominal */
+    uint8_t ref_ch;              /**< Index of the reference channel in MC1081_Snapshot_t::ch */
+    uint8_t learn;               /**< 1: keep updating alpha_ref */
+    uint8_t has_origin;          /**< 1: t0_mc / ref0 are set */
+    uint8_t alpha_valid;         /**< 1: alpha_ppm is usable */
+
+    int32_t t0_mc;    /**< Temperature the counts are referred to, m°C */
+    uint32_t ref0;    /**< Reference count at t0_mc */
+    int64_t sxx;      /**< Weighted sum of dT^2 */
+    int64_t sxy;      /**< Weighted sum of dT * dRef */
+    int32_t alpha_ppm; /**< Reference channel coefficient, ppm/°C */
+
+    int32_t ch_scale_q16[MC1081_CH_NUM];   /**< Channel coefficient / alpha_ref, Q16.16 */
+    int32_t mch_scale_q16[MC1081_MCH_NUM]; /**< Mutual channel coefficient / alpha_ref, Q16.16 */
+} MC1081_Drift_t;
+
+/**
+ * @brief Initializes drift compensation with alpha learning enabled and unit scales.
+ * @param drift  [out] State.
+ * @param ref_ch [in]  MC1081_DCH_SING_REF or MC1081_DCH_DIFF_REF.
+ * @param cal    [in]  Temperature calibration, may be NULL.
+ * @return MC1081_Status_t Operation status code.
+ */
+extern MC1081_Status_t MC1081_DriftInit(MC1081_Drift_t *drift, uint8_t ref_ch, const MC1081_TempCal_t *cal);
+
+/**
+ * @brief Sets the origin (T0, reference count) explicitly, e.g. from a factory calibration.
+ * @note Without it, the first frame whose reference count is neither 0 nor MC1081_DRIFT_SAT
+ *       becomes the origin; frames before it pass through uncompensated.
+ */
+extern void MC1081_DriftSetOrigin(MC1081_Drift_t *drift, int32_t t0_mc, uint16_t ref0);
+
+/**
+ * @brief Fixes alpha_ref and stops learning.
+ * @param drift     [in] State.
+ * @param alpha_ppm [in] Reference channel coefficient, ppm/°C.
+ */
+extern void MC1081_DriftSetAlpha(MC1081_Drift_t *drift, int32_t alpha_ppm);
+
+/**
+ * @brief Clears the fit and the origin; learning restarts on the next frame.
+ */
+extern void MC1081_DriftReset(MC1081_Drift_t *drift);
+
+/**
+ * @brief Processes one frame: updates the fit and compensates all counts in place.
+ * @note This is the stage function; call it directly when not using MC1081_DriftAttach().
+ * @return true (never drops a frame).
+ */
+extern bool MC1081_DriftStage(void *drift, MC1081_Snapshot_t *snap);
+
+/**
+ * @brief Appends the compensation to a handle's frame pipeline.
+ */
+extern MC1081_Status_t MC1081_DriftAttach(MC1081_Handle_t handle, MC1081_Drift_t *drift);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
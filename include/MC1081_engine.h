@@ -0,0 +1,268 @@
+/**
+ * @file MC1081_engine.h
+ * @author https://github.com/xfp23
+ * @brief Multi-device acquisition engine, one worker thread per bus.
+ * @version 0.1
+ * @date 2026-02-05
+ *
+ * @copyright Copyright (c) 2026
+ *
+ * The engine owns a set of handles grouped by bus. Each bus gets a worker
+ * thread, so buses are read in parallel, and the devices of one bus are
+ * interleaved within a round: the worker starts every device
+ * (MC1081_AcquireBegin()), then reads each in the order their conversions end
+ * (MC1081_AcquireFinish()). One chip converts while another is read, and a
+ * round takes about the longest conversion plus the readouts instead of the
+ * sum of all conversions and readouts.
+ *
+ * Rounds are numbered. The frames of all devices for one round are delivered
+ * together as one MC1081_EngineFrame_t, from the worker that completes the
+ * round. With depth 1 no bus starts round k + 1 before round k is delivered,
+ * so every device starts converting at about the same time. A larger depth
+ * lets faster buses run ahead while frames are still grouped by round.
+ *
+ * Frames are timestamped with the clock of their bus. bus_skew_ns is the
+ * largest spread of conversion ends among the devices of one bus; skew_ns
+ * spans all buses, which only makes sense when they share one clock (e.g.
+ * CLOCK_MONOTONIC on real adapters, not separate simulated buses).
+ *
+ * Handles, buses and the engine itself must not be used by other threads
+ * while the engine runs. Requires POSIX threads; elsewhere this header
+ * declares nothing.
+ */
+#ifndef __MC1081_ENGINE_H__
+#define __MC1081_ENGINE_H__
+
+#include "MC1081.h"
+
+#if defined(__unix__) || defined(__APPLE__)
+#define MC1081_HAS_ENGINE (1)
+#else
+#define MC1081_HAS_ENGINE (0)
+#endif
+
+#if MC1081_HAS_ENGINE
+#include "pthread.h"
+#endif
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+#if MC1081_HAS_ENGINE
+
+/** @brief Most devices one engine drives */
+#ifndef MC1081_ENGINE_MAX_DEV
+#define MC1081_ENGINE_MAX_DEV (64)
+#endif
+
+/** @brief Most buses (worker threads) of one engine */
+#ifndef MC1081_ENGINE_MAX_BUS
+#define MC1081_ENGINE_MAX_BUS (16)
+#endif
+
+/** @brief Most rounds in flight, the upper bound of MC1081_EngineCfg_t::depth */
+#ifndef MC1081_ENGINE_DEPTH
+#define MC1081_ENGINE_DEPTH (4)
+#endif
+
+/**
+ * @brief Frames of all devices for one round
+ */
+typedef struct
+{
+    uint32_t round;                              /**< Round number, from 0 */
+    uint8_t num;                                 /**< Number of devices, indexed as added */
+    uint8_t good;                                /**< Devices whose read returned MC1081_OK */
+    uint64_t skew_ns;                            /**< Spread of time.conv_ns over the good frames */
+    uint64_t bus_skew_ns;                        /**< Largest such spread within one bus */
+    MC1081_Status_t sta[MC1081_ENGINE_MAX_DEV];  /**< Result of each device's read */
+    MC1081_Frame_t frame[MC1081_ENGINE_MAX_DEV]; /**< Frame of each device, valid when sta is MC1081_OK */
+} MC1081_EngineFrame_t;
+
+/**
+ * @brief Round delivery callback, called from a worker thread
+ * @note The frame is only valid during the call. Workers of later rounds may wait on it,
+ *       so copy what is needed and return.
+ */
+typedef void (*MC1081_EngineFrameFunc_t)(void *user, const MC1081_EngineFrame_t *frame);
+
+/**
+ * @brief Engine configuration
+ */
+typedef struct
+{
+    uint32_t rounds;                   /**< Rounds to run, 0: until MC1081_EngineStop() */
+    uint8_t depth;                     /**< Rounds in flight, 1 ~ MC1081_ENGINE_DEPTH; 1 starts every round on all buses together */
+    uint8_t serial;                    /**< 1: acquire the devices of a bus one after another, for comparison */
+    uint32_t budget_us;                /**< Deadline of every device per round (MC1081_SetDeadline()), 0: none */
+    MC1081_EngineFrameFunc_t on_frame; /**< Round delivery, may be NULL */
+    void *user;                        /**< Passed to on_frame */
+} MC1081_EngineCfg_t;
+
+/**
+ * @brief Throughput of one device
+ */
+typedef struct
+{
+    uint32_t frames;   /**< Good frames */
+    uint32_t errors;   /**< Failed reads, drops excluded */
+    uint32_t drops;    /**< Frames dropped by a stage */
+    uint64_t first_ns; /**< time.bus_ns of the first good frame */
+    uint64_t last_ns;  /**< time.bus_ns of the last good frame */
+    uint64_t read_ns;  /**< Sum of request -> bus completion over the good frames */
+    uint32_t rate_mhz; /**< Frame rate between the first and the last good frame, mHz */
+    uint16_t bus_pct;  /**< Share of that time spent reading this device, percent */
+} MC1081_EngineDevStats_t;
+
+/**
+ * @brief Totals of an engine
+ */
+typedef struct
+{
+    uint32_t rounds;      /**< Rounds delivered */
+    uint32_t frames;      /**< Good frames of all devices */
+    uint32_t errors;      /**< Failed reads of all devices */
+    uint32_t rate_mhz;    /**< Sum of the device frame rates, mHz */
+    uint64_t skew_max_ns; /**< Largest skew_ns of a delivered round */
+    uint64_t bus_skew_ns; /**< Largest bus_skew_ns of a delivered round */
+} MC1081_EngineStats_t;
+
+typedef struct MC1081_Engine MC1081_Engine_t;
+
+/**
+ * @brief Device slot of an engine
+ */
+typedef struct
+{
+    MC1081_Handle_t handle;        /**< Device handle */
+    const MC1081_ScanPlan_t *plan; /**< Scan plan, NULL: whole result block */
+    uint8_t bus;                   /**< Bus index */
+    uint8_t has_last;              /**< 1: last holds a good frame */
+    uint64_t ready_ns;             /**< End of the current wait, bus clock */
+    MC1081_Snapshot_t last;        /**< Last good frame, refines the prediction */
+    MC1081_EngineDevStats_t stats; /**< Throughput, updated under the engine lock */
+} MC1081_EngineDev_t;
+
+/**
+ * @brief Bus slot of an engine
+ */
+typedef struct
+{
+    MC1081_Engine_t *eng;               /**< Owner */
+    MC1081_Bus_t bus;                   /**< Bus interface, Delay sleeps the worker */
+    MC1081_ClockFunc_t clock;           /**< Clock of the bus */
+    void *clock_ctx;                    /**< Context passed to clock */
+    uint8_t dev[MC1081_ENGINE_MAX_DEV]; /**< Devices on this bus */
+    uint8_t num;                        /**< Number of devices on this bus */
+    uint8_t running;                    /**< 1: worker thread created */
+    pthread_t thread;                   /**< Worker thread */
+} MC1081_EngineBus_t;
+
+/**
+ * @brief Acquisition engine, caller-provided storage
+ */
+struct MC1081_Engine
+{
+    MC1081_EngineCfg_t cfg;                         /**< Configuration */
+    MC1081_EngineDev_t dev[MC1081_ENGINE_MAX_DEV];  /**< Devices */
+    uint8_t num;                                    /**< Number of devices */
+    MC1081_EngineBus_t bus[MC1081_ENGINE_MAX_BUS];  /**< Buses */
+    uint8_t bus_num;                                /**< Number of buses */
+    MC1081_EngineFrame_t slot[MC1081_ENGINE_DEPTH]; /**< Rounds in flight, round k in slot k % depth */
+    uint8_t posted[MC1081_ENGINE_DEPTH];            /**< Devices done per slot */
+    uint8_t running;                                /**< 1: between start and stop / wait */
+    uint8_t stop;                                   /**< 1: workers end after their round */
+    uint32_t rounds;                                /**< Rounds delivered */
+    uint64_t skew_max_ns;                           /**< Largest skew of a delivered round */
+    uint64_t bus_skew_ns;                           /**< Largest bus skew of a delivered round */
+    pthread_mutex_t lock;                           /**< Guards slots, counters and stats */
+    pthread_cond_t cond;                            /**< Signals a released slot or a stop */
+};
+
+/**
+ * @brief Initializes an empty engine.
+ * @param eng [out] Engine.
+ * @param cfg [in]  Configuration, copied.
+ * @return MC1081_Status_t MC1081_PARAM_ERR for a depth above MC1081_ENGINE_DEPTH (0 counts as 1).
+ */
+extern MC1081_Status_t MC1081_EngineInit(MC1081_Engine_t *eng, const MC1081_EngineCfg_t *cfg);
+
+/**
+ * @brief Adds a bus, served by its own worker thread.
+ * @param eng       [in]  Engine.
+ * @param bus       [in]  Bus interface whose Delay the worker sleeps with, copied.
+ * @param clock     [in]  Clock of the bus, also set as the clock of its devices.
+ * @param clock_ctx [in]  Context passed to clock.
+ * @param id        [out] Bus index, may be NULL.
+ * @return MC1081_Status_t MC1081_PARAM_ERR without Delay or clock, or when full.
+ */
+extern MC1081_Status_t MC1081_EngineAddBus(MC1081_Engine_t *eng, const MC1081_Bus_t *bus, MC1081_ClockFunc_t clock,
+                                           void *clock_ctx, uint8_t *id);
+
+/**
+ * @brief Adds an initialized device on a bus.
+ * @note The handle's clock is set to the bus clock.
+ * @param eng    [in]  Engine.
+ * @param bus    [in]  Bus index from MC1081_EngineAddBus().
+ * @param handle [in]  Device handle on that bus.
+ * @param plan   [in]  Scan plan for MC1081_AcquireFinish(), NULL for the whole result block.
+ * @param id     [out] Device index, the index of its frame in MC1081_EngineFrame_t; may be NULL.
+ * @return MC1081_Status_t MC1081_PARAM_ERR for an unknown bus or when full, MC1081_BUSY_ERR while running.
+ */
+extern MC1081_Status_t MC1081_EngineAddDevice(MC1081_Engine_t *eng, uint8_t bus, MC1081_Handle_t handle,
+                                              const MC1081_ScanPlan_t *plan, uint8_t *id);
+
+/**
+ * @brief Starts one worker thread per bus with devices.
+ * @param eng [in] Engine.
+ * @return MC1081_Status_t MC1081_BUSY_ERR if running, MC1081_ERR if a thread cannot be created.
+ */
+extern MC1081_Status_t MC1081_EngineStart(MC1081_Engine_t *eng);
+
+/**
+ * @brief Waits until every worker has run its rounds (MC1081_EngineCfg_t::rounds).
+ * @param eng [in] Engine.
+ * @return MC1081_Status_t Operation status code.
+ */
+extern MC1081_Status_t MC1081_EngineWait(MC1081_Engine_t *eng);
+
+/**
+ * @brief Stops the workers after their current round and waits for them.
+ * @note The round in progress is not delivered.
+ * @param eng [in] Engine.
+ * @return MC1081_Status_t Operation status code.
+ */
+extern MC1081_Status_t MC1081_EngineStop(MC1081_Engine_t *eng);
+
+/**
+ * @brief Stops the engine and releases its lock, the handles stay initialized.
+ * @param eng [in] Engine.
+ */
+extern void MC1081_EngineDeInit(MC1081_Engine_t *eng);
+
+/**
+ * @brief Copies the throughput of one device, also while running.
+ * @param eng   [in]  Engine.
+ * @param dev   [in]  Device index.
+ * @param stats [out] Throughput.
+ * @return MC1081_Status_t MC1081_PARAM_ERR for an unknown device.
+ */
+extern MC1081_Status_t MC1081_EngineDevStats(MC1081_Engine_t *eng, uint8_t dev, MC1081_EngineDevStats_t *stats);
+
+/**
+ * @brief Totals of all devices, also while running.
+ * @param eng   [in]  Engine.
+ * @param stats [out] Totals.
+ * @return MC1081_Status_t Operation status code.
+ */
+extern MC1081_Status_t MC1081_EngineStats(MC1081_Engine_t *eng, MC1081_EngineStats_t *stats);
+
+#endif
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
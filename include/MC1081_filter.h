@@ -0,0 +1,148 @@
+/**
+ * @file MC1081_filter.h
+ * @author https://github.com/xfp23
+ * @brief Streaming per-channel filter chain, fixed point, as a frame stage.
+ * @version 0.1
+ * @date 2026-02-05
+ *
+ * @copyright Copyright (c) 2026
+ *
+ * The filter runs over 16 lanes, the 11 channel counts followed by the 5
+ * mutual channel counts of a frame, with state stored lane-contiguous
+ * (struct of arrays). Each frame goes through, in order:
+ *
+ *   median of N (spike rejection) -> boxcar of N -> single-pole IIR -> decimation
+ *
+ * Every block is enabled per lane. Boxcar and IIR keep Q16 state; the frame
+ * receives the rounded count and the full Q16 value stays readable through
+ * MC1081_FilterOutQ16(). Cost per lane is constant: a running sum for the
+ * boxcar, one shift for the IIR, and an insertion into a window of at most
+ * MC1081_FILTER_MAX_MEDIAN samples for the median. A saturated count (0xFFFF)
+ * passes through unchanged and leaves the lane's state untouched.
+ */
+#ifndef __MC1081_FILTER_H__
+#define __MC1081_FILTER_H__
+
+#include "MC1081.h"
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/** @brief Number of filtered lanes: channels, then mutual channels */
+#define MC1081_FILTER_LANES (MC1081_CH_NUM + MC1081_MCH_NUM)
+
+/** @brief Lane index of mutual channel k */
+#define MC1081_FILTER_LANE_MCH(k) (MC1081_CH_NUM + (k))
+
+/** @brief Lane mask covering every lane */
+#define MC1081_FILTER_ALL_LANES (0xFFFFU)
+
+/** @brief Longest median window (odd) */
+#ifndef MC1081_FILTER_MAX_MEDIAN
+#define MC1081_FILTER_MAX_MEDIAN (7)
+#endif
+
+/** @brief Longest boxcar window */
+#ifndef MC1081_FILTER_MAX_BOXCAR
+#define MC1081_FILTER_MAX_BOXCAR (32)
+#endif
+
+/**
+ * @brief Filter chain state, also the context of its stage
+ */
+typedef struct
+{
+    MC1081_Stage_t stage; /**< Pipeline node used by MC1081_FilterAttach() */
+    uint16_t primed;      /**< Bit n set: lane n has seen its first sample */
+
+    /* 中值 */
+    uint16_t med_lanes; /**< Lanes with the median enabled */
+    uint8_t med_n;      /**< Window length */
+    uint8_t med_pos;    /**< Next tap to overwrite */
+    uint16_t med_hist[MC1081_FILTER_MAX_MEDIAN][MC1081_FILTER_LANES];
+
+    /* 滑动平均 */
+    uint16_t box_lanes; /**< Lanes with the boxcar enabled */
+    uint8_t box_n;      /**< Window length */
+    uint8_t box_pos;    /**< Next tap to overwrite */
+    uint32_t box_recip; /**< 2^32 / box_n */
+    uint32_t box_sum[MC1081_FILTER_LANES];
+    uint16_t box_hist[MC1081_FILTER_MAX_BOXCAR][MC1081_FILTER_LANES];
+
+    /* 一阶 IIR: y += (x - y) / 2^k */
+    uint8_t iir_shift[MC1081_FILTER_LANES]; /**< k per lane, 0: off */
+
+    uint32_t out_q16[MC1081_FILTER_LANES]; /**< Last output per lane, Q16.16 counts */
+
+    /* 抽取 */
+    uint8_t decim;     /**< Keep one frame out of decim */
+    uint8_t decim_cnt; /**< Frames since the last kept one */
+} MC1081_Filter_t;
+
+/**
+ * @brief Initializes a filter with every block disabled (pass-through).
+ */
+extern void MC1081_FilterInit(MC1081_Filter_t *filter);
+
+/**
+ * @brief Configures the median block.
+ * @param filter [in] Filter.
+ * @param lanes  [in] Lane mask (bit n: lane n).
+ * @param n      [in] Odd window length up to MC1081_FILTER_MAX_MEDIAN, 0 or 1 disables.
+ * @return MC1081_Status_t MC1081_PARAM_ERR for an even or too long window.
+ */
+extern MC1081_Status_t MC1081_FilterSetMedian(MC1081_Filter_t *filter, uint16_t lanes, uint8_t n);
+
+/**
+ * @brief Configures the boxcar block.
+ * @param filter [in] Filter.
+ * @param lanes  [in] Lane mask.
+ * @param n      [in] Window length up to MC1081_FILTER_MAX_BOXCAR, 0 or 1 disables.
+ * @return MC1081_Status_t MC1081_PARAM_ERR for a too long window.
+ */
+extern MC1081_Status_t MC1081_FilterSetBoxcar(MC1081_Filter_t *filter, uint16_t lanes, uint8_t n);
+
+/**
+ * @brief Configures the IIR block: y += (x - y) / 2^shift.
+ * @param filter [in] Filter.
+ * @param lanes  [in] Lanes to configure, the others keep their setting.
+ * @param shift  [in] 1 ~ 15, 0 disables. The time constant is about 2^shift frames.
+ * @return MC1081_Status_t Operation status code.
+ */
+extern MC1081_Status_t MC1081_FilterSetIir(MC1081_Filter_t *filter, uint16_t lanes, uint8_t shift);
+
+/**
+ * @brief Keeps one frame out of m; the others are dropped with MC1081_DROP_ERR.
+ * @param filter [in] Filter.
+ * @param m      [in] Decimation factor, 0 or 1 disables.
+ */
+extern void MC1081_FilterSetDecimation(MC1081_Filter_t *filter, uint8_t m);
+
+/**
+ * @brief Restarts every lane; the next sample refills all windows.
+ */
+extern void MC1081_FilterReset(MC1081_Filter_t *filter);
+
+/**
+ * @brief Last filter output of a lane with 16 fraction bits.
+ */
+extern uint32_t MC1081_FilterOutQ16(const MC1081_Filter_t *filter, uint8_t lane);
+
+/**
+ * @brief Processes one frame in place. This is the stage function.
+ * @return false when decimation drops the frame.
+ */
+extern bool MC1081_FilterStage(void *filter, MC1081_Snapshot_t *snap);
+
+/**
+ * @brief Appends the filter to a handle's frame pipeline.
+ */
+extern MC1081_Status_t MC1081_FilterAttach(MC1081_Handle_t handle, MC1081_Filter_t *filter);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,111 @@
+/**
+ * @file MC1081_kernels.h
+ * @author https://github.com/xfp23
+ * @brief Block kernels for decoding and converting recorded channel words.
+ * @version 0.1
+ * @date 2026-02-05
+ *
+ * @copyright Copyright (c) 2026
+ *
+ * The kernels work on contiguous buffers of one channel: MSB-first 16-bit
+ * words exactly as they come out of the result registers. Each instruction
+ * set provides the same operations through a MC1081_Kernels_t table, and all
+ * tables produce bit-identical fixed-point results:
+ *
+ *   d     = x - ref                        (ref optional)
+ *   fixed = sign(d) * round(|d| * K * gain) + offset      fF
+ *   float = d * K * gain / 1000 + offset / 1000           pF
+ *
+ * K is the factor of a MC1081_Conv_t, rounding is half away from zero, and a
+ * saturated word (0xFFFF in x or ref) yields MC1081_CONV_OVERFLOW / +inf.
+ */
+#ifndef __MC1081_KERNELS_H__
+#define __MC1081_KERNELS_H__
+
+#include "MC1081_conv.h"
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/** @brief 0: build the scalar kernels only */
+#ifndef MC1081_USE_SIMD
+#define MC1081_USE_SIMD (1)
+#endif
+
+/**
+ * @brief Kernel instruction sets
+ */
+typedef enum
+{
+    MC1081_ISA_SCALAR, /**< Portable C */
+    MC1081_ISA_SSE2,   /**< x86 SSE2 */
+    MC1081_ISA_AVX2,   /**< x86 AVX2, selected at run time */
+    MC1081_ISA_NEON,   /**< Arm NEON */
+    MC1081_ISA_NUM,
+} MC1081_Isa_t;
+
+/**
+ * @brief Per-channel conversion parameters, see MC1081_KParamInit()
+ */
+typedef struct
+{
+    uint32_t mant;     /**< fF per count = mant / 2^shift, gain included */
+    uint8_t shift;     /**< Fraction bits of mant */
+    uint64_t round;    /**< 2^(shift - 1) */
+    int32_t offset_ff; /**< Added after scaling, fF */
+    float scale_pf;    /**< pF per count, gain included */
+    float offset_pf;   /**< Added after scaling, pF */
+} MC1081_KParam_t;
+
+/**
+ * @brief Kernel table of one instruction set
+ */
+typedef struct
+{
+    MC1081_Isa_t isa; /**< Instruction set */
+    const char *name; /**< "scalar", "sse2", "avx2" or "neon" */
+
+    /**
+     * @brief Byte-swaps n MSB-first words into native counts.
+     */
+    void (*Decode)(const uint8_t *src, uint16_t *dst, size_t n);
+
+    /**
+     * @brief Decodes, subtracts ref (may be NULL), scales and offsets to fF.
+     */
+    void (*Fixed)(const uint8_t *src, const uint8_t *ref, int32_t *dst, size_t n, const MC1081_KParam_t *p);
+
+    /**
+     * @brief Decodes, subtracts ref (may be NULL), scales and offsets to pF.
+     */
+    void (*Float)(const uint8_t *src, const uint8_t *ref, float *dst, size_t n, const MC1081_KParam_t *p);
+} MC1081_Kernels_t;
+
+/**
+ * @brief Builds channel parameters from a conversion context.
+ * @param p         [out] Parameters.
+ * @param conv      [in]  Conversion context with a computed factor.
+ * @param gain_q16  [in]  Channel gain, Q16.16 (65536 = 1.0).
+ * @param offset_ff [in]  Channel offset, fF. The context's parasitic capacitance is not applied.
+ * @return MC1081_Status_t MC1081_PARAM_ERR if a full-scale result would not fit in 31 bits.
+ */
+extern MC1081_Status_t MC1081_KParamInit(MC1081_KParam_t *p, const MC1081_Conv_t *conv, uint32_t gain_q16, int32_t offset_ff);
+
+/**
+ * @brief Returns the kernel table of an instruction set.
+ * @return NULL if the set is not built in or not supported by this CPU.
+ */
+extern const MC1081_Kernels_t *MC1081_KernelsGet(MC1081_Isa_t isa);
+
+/**
+ * @brief Returns the fastest kernel table available on this CPU.
+ */
+extern const MC1081_Kernels_t *MC1081_KernelsBest(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,109 @@
+/**
+ * @file MC1081_latency.h
+ * @author https://github.com/xfp23
+ * @brief Acquisition latency histograms and percentiles.
+ * @version 0.1
+ * @date 2026-02-05
+ *
+ * @copyright Copyright (c) 2026
+ *
+ * With a clock set by MC1081_SetClock() every frame carries three times
+ * (MC1081_FrameTime_t). The consumer records a frame together with the time
+ * it took the frame over, and four latencies are accumulated:
+ *
+ *   BUS               request -> bus completion (transfer time)
+ *   CONV_TO_READ      conversion end (estimate) -> bus completion (data age when read)
+ *   READ_TO_CONSUMER  bus completion -> consumer (stages, queueing, scheduling)
+ *   END_TO_END        conversion end (estimate) -> consumer
+ *
+ * Each latency goes into a MC1081_LatHist_t, the log-linear histogram the
+ * driver statistics use as well (MC1081_LatHistAdd()).
+ */
+#ifndef __MC1081_LATENCY_H__
+#define __MC1081_LATENCY_H__
+
+#include "MC1081.h"
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/**
+ * @brief Measured latency
+ */
+typedef enum
+{
+    MC1081_LAT_BUS,              /**< request_ns -> bus_ns */
+    MC1081_LAT_CONV_TO_READ,     /**< conv_ns -> bus_ns */
+    MC1081_LAT_READ_TO_CONSUMER, /**< bus_ns -> consumer */
+    MC1081_LAT_END_TO_END,       /**< conv_ns -> consumer */
+    MC1081_LAT_PATH_NUM,
+} MC1081_LatPath_t;
+
+/**
+ * @brief Latency statistics of a consumer
+ */
+typedef struct
+{
+    MC1081_LatHist_t path[MC1081_LAT_PATH_NUM]; /**< Indexed by MC1081_LatPath_t */
+} MC1081_Latency_t;
+
+/**
+ * @brief Usual percentiles of one latency, ns
+ */
+typedef struct
+{
+    uint32_t count; /**< Number of samples */
+    uint32_t min;   /**< Smallest sample */
+    uint32_t p50;   /**< Median */
+    uint32_t p90;   /**< 90th percentile */
+    uint32_t p99;   /**< 99th percentile */
+    uint32_t p999;  /**< 99.9th percentile */
+    uint32_t max;   /**< Largest sample */
+} MC1081_LatSummary_t;
+
+/**
+ * @brief Clears all histograms.
+ * @param lat [out] Statistics.
+ */
+extern void MC1081_LatencyInit(MC1081_Latency_t *lat);
+
+/**
+ * @brief Adds one sample to one histogram.
+ * @param lat  [in] Statistics.
+ * @param path [in] Latency.
+ * @param ns   [in] Sample, clamped to UINT32_MAX.
+ */
+extern void MC1081_LatencyAdd(MC1081_Latency_t *lat, MC1081_LatPath_t path, uint64_t ns);
+
+/**
+ * @brief Records every latency of a frame taken over by the consumer.
+ * @note Frames without times (no clock) are ignored. A time later than the one it is
+ *       measured to counts as 0.
+ * @param lat         [in] Statistics.
+ * @param time        [in] Frame times, e.g. MC1081_Frame_t::time.
+ * @param consumed_ns [in] When the consumer took the frame, same clock.
+ */
+extern void MC1081_LatencyRecord(MC1081_Latency_t *lat, const MC1081_FrameTime_t *time, uint64_t consumed_ns);
+
+/**
+ * @brief Percentile of one latency.
+ * @param lat      [in] Statistics.
+ * @param path     [in] Latency.
+ * @param permille [in] Rank, 0 ~ 1000 (999 is the 99.9th percentile).
+ * @return Upper edge of the bucket holding the percentile (never above the largest sample), 0 without samples.
+ */
+extern uint32_t MC1081_LatencyPercentile(const MC1081_Latency_t *lat, MC1081_LatPath_t path, uint16_t permille);
+
+/**
+ * @brief Usual percentiles of one latency.
+ * @return MC1081_Status_t MC1081_PARAM_ERR for a bad path.
+ */
+extern MC1081_Status_t MC1081_LatencySummary(const MC1081_Latency_t *lat, MC1081_LatPath_t path, MC1081_LatSummary_t *out);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
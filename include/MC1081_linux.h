@@ -0,0 +1,119 @@
+/**
+ * @file MC1081_linux.h
+ * @author https://github.com/xfp23
+ * @brief Linux i2c-dev bus backend with combined repeated-start reads.
+ * @version 0.1
+ * @date 2026-02-05
+ *
+ * @copyright Copyright (c) 2026
+ *
+ * Every transfer is one I2C_RDWR ioctl on /dev/i2c-N. A register read (pointer
+ * write, repeated start, data read) goes out through MC1081_Bus_t::ReadRegs as
+ * one ioctl with two messages, instead of a write and a read each with its own
+ * START / STOP and system call. MC1081_ScanRead() hands all bursts of a plan
+ * over at once, so a planned scan is one ioctl too (split only beyond
+ * I2C_RDWR_IOCTL_MAX_MSGS messages).
+ *
+ * Kernel error codes are mapped to MC1081_BUS_*: ENXIO (address not
+ * acknowledged) to MC1081_BUS_ADDR_NACK, EREMOTEIO to MC1081_BUS_DATA_NACK,
+ * ETIMEDOUT to MC1081_BUS_TIMEOUT. The adapter's own timeout (I2C_TIMEOUT)
+ * bounds a stalled transfer; MC1081_Bus_t::Deadline is not used.
+ *
+ * Without hardware, set `xfer` to MC1081_SimLinuxXfer() of MC1081_sim.h to
+ * run the same message lists against the software model. The kernel's
+ * i2c-stub emulates SMBus only and is refused by MC1081_LinuxBusOpen().
+ *
+ * Only built on Linux; elsewhere this header declares nothing.
+ */
+#ifndef __MC1081_LINUX_H__
+#define __MC1081_LINUX_H__
+
+#include "MC1081.h"
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+#ifdef __linux__
+
+struct i2c_msg;
+
+/**
+ * @brief Message list transfer, replaces the I2C_RDWR ioctl
+ * @return 0 on success, a negative errno value on failure
+ */
+typedef int (*MC1081_LinuxXferFunc_t)(void *ctx, struct i2c_msg *msgs, uint32_t num);
+
+/**
+ * @brief Linux I2C adapter, the ctx of the MC1081_Bus_t it provides
+ */
+typedef struct
+{
+    int fd;                      /**< Open /dev/i2c-N, -1 when closed */
+    MC1081_LinuxXferFunc_t xfer; /**< Transfer hook for tests, NULL: ioctl(fd, I2C_RDWR) */
+    void *xfer_ctx;              /**< Context passed to xfer */
+    uint32_t calls;              /**< Transfers issued (system calls without a hook) */
+    uint32_t msgs;               /**< I2C messages issued */
+} MC1081_LinuxBus_t;
+
+/**
+ * @brief Opens an i2c-dev adapter.
+ * @param bus  [out] Adapter.
+ * @param path [in]  Device node, e.g. "/dev/i2c-1".
+ * @return MC1081_Status_t MC1081_ERR if the node cannot be opened or lacks I2C_FUNC_I2C.
+ */
+extern MC1081_Status_t MC1081_LinuxBusOpen(MC1081_LinuxBus_t *bus, const char *path);
+
+/**
+ * @brief Initializes an adapter without a device node, every transfer goes to xfer.
+ * @param bus  [out] Adapter.
+ * @param xfer [in]  Transfer hook, e.g. MC1081_SimLinuxXfer.
+ * @param ctx  [in]  Context passed to xfer.
+ */
+extern void MC1081_LinuxBusInitHook(MC1081_LinuxBus_t *bus, MC1081_LinuxXferFunc_t xfer, void *ctx);
+
+/**
+ * @brief Closes the adapter.
+ */
+extern void MC1081_LinuxBusClose(MC1081_LinuxBus_t *bus);
+
+/**
+ * @brief Fills a driver bus interface that talks to the adapter, ReadRegs included.
+ * @param bus [in]  Adapter.
+ * @param out [out] Interface for MC1081_InitBus() / MC1081_InitStatic().
+ */
+extern void MC1081_LinuxBusInterface(MC1081_LinuxBus_t *bus, MC1081_Bus_t *out);
+
+/**
+ * @brief Bus write callback, ctx is a MC1081_LinuxBus_t.
+ */
+extern int MC1081_LinuxBusWrite(void *ctx, uint8_t addr, const uint8_t *data, size_t len);
+
+/**
+ * @brief Bus read callback, ctx is a MC1081_LinuxBus_t.
+ */
+extern int MC1081_LinuxBusRead(void *ctx, uint8_t addr, uint8_t *dst, size_t len);
+
+/**
+ * @brief Combined read callback, ctx is a MC1081_LinuxBus_t. Two messages per burst, one transfer.
+ */
+extern int MC1081_LinuxBusReadRegs(void *ctx, uint8_t addr, const MC1081_ScanBurst_t *burst, uint8_t num, uint8_t *dst);
+
+/**
+ * @brief Bus delay callback, sleeps with nanosleep().
+ */
+extern void MC1081_LinuxBusDelay(void *ctx, uint32_t us);
+
+/**
+ * @brief Clock callback for MC1081_SetClock(), CLOCK_MONOTONIC in ns.
+ */
+extern uint64_t MC1081_LinuxBusClock(void *ctx);
+
+#endif
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,126 @@
+/**
+ * @file MC1081_profile.h
+ * @author https://github.com/xfp23
+ * @brief Serialized configuration profiles and warm start.
+ * @version 0.1
+ * @date 2026-02-05
+ *
+ * @copyright Copyright (c) 2026
+ *
+ * A profile is the register image of 0x1C ~ 0x26 plus the parameters the
+ * conversion and calibration need (reference clock, supply voltage,
+ * parasitic capacitance, temperature calibration, drift coefficient).
+ * It serializes to MC1081_PROFILE_SIZE bytes, little-endian, for flash or a
+ * file:
+ *
+ *   off  size  field
+ *     0     2  magic "M1"
+ *     2     1  version (MC1081_PROFILE_VERSION)
+ *     3     1  size (MC1081_PROFILE_SIZE)
+ *     4    11  registers 0x1C ~ 0x26
+ *    15     1  flags (MC1081_PROFILE_F_*)
+ *    16     4  reference clock, Hz
+ *    20     2  supply voltage, mV
+ *    22     4  parasitic capacitance, fF
+ *    26     4  temperature gain, Q16.16
+ *    30     4  temperature offset, m°C
+ *    34     4  drift coefficient, ppm/°C
+ *    38     2  CRC-16/CCITT-FALSE of bytes 0 ~ 37
+ *
+ * MC1081_ProfileWarmStart() reads the configuration block back once. When the
+ * device still holds the profile (the MCU rebooted, the chip did not), reset
+ * and configuration writes are skipped.
+ */
+#ifndef __MC1081_PROFILE_H__
+#define __MC1081_PROFILE_H__
+
+#include "MC1081_drift.h"
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/** @brief Serialized profile size, bytes */
+#define MC1081_PROFILE_SIZE (40U)
+
+/** @brief Format version written and accepted */
+#define MC1081_PROFILE_VERSION (1U)
+
+/** @brief alpha_ppm holds a drift coefficient */
+#define MC1081_PROFILE_F_ALPHA (0x01U)
+
+/**
+ * @brief Decoded profile
+ */
+typedef struct
+{
+    uint8_t regs[MC1081_CFG_REG_NUM]; /**< Registers 0x1C ~ 0x26 */
+    uint8_t flags;                    /**< MC1081_PROFILE_F_* */
+    uint32_t fref_hz;                 /**< Reference clock */
+    uint16_t vdd_mv;                  /**< Supply voltage */
+    int32_t cpar_ff;                  /**< Parasitic capacitance */
+    MC1081_TempCal_t temp;            /**< Temperature calibration */
+    int32_t alpha_ppm;                /**< Drift coefficient, valid with MC1081_PROFILE_F_ALPHA */
+} MC1081_Profile_t;
+
+/**
+ * @brief Captures the current configuration and parameters into a profile.
+ * @note The registers come from the shadow copy, read from the device where it is not valid.
+ * @param handle  [in]  Device handle.
+ * @param profile [out] Profile.
+ * @param conv    [in]  Conversion context (reference clock, supply, parasitic), may be NULL.
+ * @param cal     [in]  Temperature calibration, may be NULL.
+ * @param drift   [in]  Drift compensation, may be NULL; its coefficient is kept if valid.
+ * @return MC1081_Status_t Operation status code.
+ */
+extern MC1081_Status_t MC1081_ProfileCapture(MC1081_Handle_t handle, MC1081_Profile_t *profile, const MC1081_Conv_t *conv,
+                                             const MC1081_TempCal_t *cal, const MC1081_Drift_t *drift);
+
+/**
+ * @brief Serializes a profile.
+ * @param profile [in]  Profile.
+ * @param buf     [out] MC1081_PROFILE_SIZE bytes.
+ */
+extern void MC1081_ProfileSerialize(const MC1081_Profile_t *profile, uint8_t *buf);
+
+/**
+ * @brief Parses a serialized profile.
+ * @param profile [out] Profile.
+ * @param buf     [in]  Serialized profile.
+ * @param len     [in]  Bytes available in buf.
+ * @return MC1081_Status_t MC1081_PARAM_ERR for a short buffer or a foreign format,
+ *         MC1081_ERR for a CRC mismatch.
+ */
+extern MC1081_Status_t MC1081_ProfileParse(MC1081_Profile_t *profile, const uint8_t *buf, size_t len);
+
+/**
+ * @brief Brings a device to a profile, skipping reset and writes when it already matches.
+ * @note The configuration block is read once. On a mismatch the device is reset and the
+ *       profile is written with MC1081_DeviceConfigApply().
+ * @param handle  [in]  Device handle.
+ * @param profile [in]  Profile.
+ * @param warm    [out] 1 if the device already held the profile, may be NULL.
+ * @return MC1081_Status_t Operation status code.
+ */
+extern MC1081_Status_t MC1081_ProfileWarmStart(MC1081_Handle_t handle, const MC1081_Profile_t *profile, uint8_t *warm);
+
+/**
+ * @brief Restores the parameters of a profile.
+ * @note Sets the handle's reference clock and recomputes conv through MC1081_ConvSync(),
+ *       so call it after MC1081_ProfileWarmStart().
+ * @param handle  [in]  Device handle.
+ * @param profile [in]  Profile.
+ * @param conv    [out] Conversion context, may be NULL.
+ * @param cal     [out] Temperature calibration, may be NULL.
+ * @param drift   [out] Drift compensation, may be NULL; the coefficient is fixed if the profile has one.
+ * @return MC1081_Status_t Operation status code.
+ */
+extern MC1081_Status_t MC1081_ProfileRestore(MC1081_Handle_t handle, const MC1081_Profile_t *profile, MC1081_Conv_t *conv,
+                                             MC1081_TempCal_t *cal, MC1081_Drift_t *drift);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
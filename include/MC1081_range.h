@@ -0,0 +1,105 @@
+/**
+ * @file MC1081_range.h
+ * @author https://github.com/xfp23
+ * @brief Overflow-driven auto-ranging of FINDIV / FREFDIV / N.
+ * @version 0.1
+ * @date 2026-02-05
+ *
+ * @copyright Copyright (c) 2026
+ *
+ * A count is proportional to the measurement gain
+ *
+ *   g = N * 2^FINDIV / 2^FREFDIV
+ *
+ * so the controller scales g to bring the largest watched count of a frame
+ * back to the target whenever it leaves the [low, high] window, and divides
+ * g by 4 when a watched channel overflows. The new gain is realized with
+ * the smallest FREFDIV (finest count resolution), then the smallest FINDIV,
+ * with N taking the remainder. Overflow flags are cleared with a single
+ * write. Only changed registers are written, through the shadow registers.
+ *
+ * Lanes follow the OSC1 overflow layout: bit 0 ~ 10 channels, bit 11 ~ 15
+ * mutual channels. In differential mode bit 0 ~ 5 select the differential
+ * channels.
+ */
+#ifndef __MC1081_RANGE_H__
+#define __MC1081_RANGE_H__
+
+#include "MC1081.h"
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/** @brief Default window, counts: retune below low or above high, aim at target */
+#define MC1081_RANGE_LOW (26214U)    /* 40 % */
+#define MC1081_RANGE_TARGET (45875U) /* 70 % */
+#define MC1081_RANGE_HIGH (58982U)   /* 90 % */
+
+/** @brief Largest gain, N * 2^FINDIV * 8 / 2^FREFDIV = 255 * 64 * 8 */
+#define MC1081_RANGE_GAIN8_MAX (255UL << 9)
+
+/**
+ * @brief Auto-range state, also the context of its stage
+ */
+typedef struct
+{
+    MC1081_Stage_t stage;   /**< Pipeline node used by MC1081_RangeAttach() */
+    MC1081_Handle_t handle; /**< Device retuned by the stage */
+
+    uint16_t lanes;     /**< Watched lanes */
+    uint16_t low;       /**< Retune when the largest count is below */
+    uint16_t target;    /**< Largest count aimed at */
+    uint16_t high;      /**< Retune when the largest count is above */
+    uint32_t gain8_max; /**< Upper bound of N * 2^FINDIV * 8 / 2^FREFDIV, bounds the conversion time */
+    uint8_t settle;     /**< Frames ignored after a retune */
+    uint8_t skip;       /**< Frames still to ignore */
+
+    uint32_t retunes;   /**< Number of retunes */
+    uint32_t overflows; /**< Number of frames with a watched channel overflowed */
+} MC1081_Range_t;
+
+/**
+ * @brief Initializes the controller with the default window.
+ * @param range [out] State.
+ * @param lanes [in]  Watched lanes.
+ */
+extern void MC1081_RangeInit(MC1081_Range_t *range, uint16_t lanes);
+
+/**
+ * @brief Sets the count window.
+ * @return MC1081_Status_t MC1081_PARAM_ERR unless low < target < high < 0xFFFF.
+ */
+extern MC1081_Status_t MC1081_RangeSetWindow(MC1081_Range_t *range, uint16_t low, uint16_t target, uint16_t high);
+
+/**
+ * @brief Evaluates one frame and retunes the device if needed.
+ * @param handle  [in]  Device handle.
+ * @param range   [in]  State.
+ * @param snap    [in]  Frame.
+ * @param changed [out] 1 if the clock configuration or N changed, may be NULL.
+ * @note After a retune the counts (and the capacitance factor, see MC1081_ConvSync())
+ *       are on a different scale.
+ * @return MC1081_Status_t Operation status code.
+ */
+extern MC1081_Status_t MC1081_RangeUpdate(MC1081_Handle_t handle, MC1081_Range_t *range, const MC1081_Snapshot_t *snap, uint8_t *changed);
+
+/**
+ * @brief Stage function: MC1081_RangeUpdate() on the attached handle.
+ * @note It accesses the bus, so do not use it with asynchronous acquisition.
+ * @return false for frames with a watched overflow or taken while settling.
+ */
+extern bool MC1081_RangeStage(void *range, MC1081_Snapshot_t *snap);
+
+/**
+ * @brief Appends the controller to a handle's frame pipeline.
+ * @note Attach it before the stages that depend on the count scale.
+ */
+extern MC1081_Status_t MC1081_RangeAttach(MC1081_Handle_t handle, MC1081_Range_t *range);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
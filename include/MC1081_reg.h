@@ -18,6 +18,23 @@ extern "C"
 {
 #endif
 
+/* Register addresses */
+#define MC1081_REG_TDATA     (0x00) /**< Temperature data, 2 bytes */
+#define MC1081_REG_CHDATA    (0x02) /**< Channel data, 2 bytes per channel, MSB first */
+#define MC1081_REG_OSC1      (0x18) /**< Single-ended / mutual overflow flags, 2 bytes */
+#define MC1081_REG_OSC2      (0x1A) /**< Differential overflow flags */
+#define MC1081_REG_STATUS    (0x1B) /**< Conversion status and OF_CLEAR */
+#define MC1081_REG_T_CMD     (0x1C) /**< Temperature command */
+#define MC1081_REG_C_CMD     (0x1D) /**< Capacitance command */
+#define MC1081_REG_FIN_CNT   (0x1E) /**< FIN cycle count N */
+#define MC1081_REG_DIV_CFG   (0x1F) /**< Clock divider configuration */
+#define MC1081_REG_OSC1_CHS  (0x20) /**< Single-ended channel enable, 2 bytes, LSB first */
+#define MC1081_REG_OSC1_MCHS (0x22) /**< Mutual channel enable */
+#define MC1081_REG_OSC1_CFG  (0x23) /**< Single-ended oscillator configuration */
+#define MC1081_REG_OSC2_DCHS (0x24) /**< Differential channel enable */
+#define MC1081_REG_OSC2_CFG  (0x25) /**< Differential oscillator configuration */
+#define MC1081_REG_SHLD_CFG  (0x26) /**< Active shield configuration */
+
 typedef union
 {
     struct __attribute__((packed))
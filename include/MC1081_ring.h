@@ -0,0 +1,112 @@
+/**
+ * @file MC1081_ring.h
+ * @author https://github.com/xfp23
+ * @brief Lock-free single-producer / single-consumer ring of acquisition frames.
+ * @version 0.1
+ * @date 2026-02-05
+ *
+ * @copyright Copyright (c) 2026
+ *
+ * One context (ISR or acquisition thread) pushes, one context pops. Both sides
+ * are wait-free. Producer and consumer indices live on separate cache lines,
+ * and each side keeps a private copy of the other side's index so that it only
+ * touches the shared line when its copy says the ring is full / empty.
+ */
+#ifndef __MC1081_RING_H__
+#define __MC1081_RING_H__
+
+#include "MC1081.h"
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/** @brief Cache line size used to separate producer and consumer state */
+#ifndef MC1081_CACHE_LINE
+#define MC1081_CACHE_LINE (64)
+#endif
+
+/**
+ * @brief SPSC frame ring
+ *
+ * Storage is provided by the caller, the capacity must be a power of two.
+ */
+typedef struct
+{
+    /* 生产者独占 */
+    __attribute__((aligned(MC1081_CACHE_LINE))) uint32_t head; /**< Next slot to write, free-running */
+    uint32_t tail_cache;                                      /**< Producer's copy of tail */
+
+    /* 消费者独占 */
+    __attribute__((aligned(MC1081_CACHE_LINE))) uint32_t tail; /**< Next slot to read, free-running */
+    uint32_t head_cache;                                      /**< Consumer's copy of head */
+
+    /* 只读 */
+    __attribute__((aligned(MC1081_CACHE_LINE))) MC1081_Frame_t *buf; /**< Frame storage */
+    uint32_t mask;                                                  /**< Capacity - 1 */
+} MC1081_Ring_t;
+
+/**
+ * @brief Initializes a ring on caller-provided storage.
+ * @param ring     [out] Ring to initialize.
+ * @param storage  [in]  Array of `capacity` frames, ideally MC1081_CACHE_LINE aligned.
+ * @param capacity [in]  Number of frames, power of two (usable slots: capacity).
+ * @return MC1081_Status_t MC1081_PARAM_ERR if capacity is not a power of two.
+ */
+extern MC1081_Status_t MC1081_RingInit(MC1081_Ring_t *ring, MC1081_Frame_t *storage, uint32_t capacity);
+
+/**
+ * @brief Producer: copies one frame into the ring.
+ * @return true on success, false if the ring is full.
+ */
+extern bool MC1081_RingPush(MC1081_Ring_t *ring, const MC1081_Frame_t *frame);
+
+/**
+ * @brief Producer: returns the next free slot to be filled in place, or NULL if full.
+ * @note Publish it with MC1081_RingCommit().
+ */
+extern MC1081_Frame_t *MC1081_RingAcquire(MC1081_Ring_t *ring);
+
+/**
+ * @brief Producer: publishes the slot returned by MC1081_RingAcquire().
+ */
+extern void MC1081_RingCommit(MC1081_Ring_t *ring);
+
+/**
+ * @brief Consumer: copies out the oldest frame.
+ * @return true on success, false if the ring is empty.
+ */
+extern bool MC1081_RingPop(MC1081_Ring_t *ring, MC1081_Frame_t *frame);
+
+/**
+ * @brief Consumer: returns the oldest frame without copying, or NULL if empty.
+ * @note Hand the slot back with MC1081_RingRelease().
+ */
+extern const MC1081_Frame_t *MC1081_RingPeek(MC1081_Ring_t *ring);
+
+/**
+ * @brief Consumer: releases the slot returned by MC1081_RingPeek().
+ */
+extern void MC1081_RingRelease(MC1081_Ring_t *ring);
+
+/**
+ * @brief Number of frames currently queued (approximate when called from a third context).
+ */
+extern uint32_t MC1081_RingCount(const MC1081_Ring_t *ring);
+
+/**
+ * @brief Reads a snapshot straight into the next ring slot and publishes it.
+ * @note The frame's time holds the read times when a clock is set, see MC1081_SetClock().
+ * @param handle    [in] Device handle.
+ * @param ring      [in] Ring, the caller is its only producer.
+ * @param timestamp [in] Capture time stored in the frame.
+ * @return MC1081_Status_t MC1081_FULL_ERR if no slot is free, bus errors otherwise.
+ */
+extern MC1081_Status_t MC1081_AcquireToRing(MC1081_Handle_t handle, MC1081_Ring_t *ring, uint64_t timestamp);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
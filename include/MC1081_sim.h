@@ -0,0 +1,219 @@
+/**
+ * @file MC1081_sim.h
+ * @author https://github.com/xfp23
+ * @brief Host-side software model of the MC1081, usable as a bus backend.
+ * @version 0.1
+ * @date 2026-02-05
+ *
+ * @copyright Copyright (c) 2026
+ *
+ * The model implements the register map of MC1081_reg.h:
+ * - auto-increment register pointer for reads and writes
+ * - software reset (0x7A written to 0x69)
+ * - OF_CLEAR in STATUS and the per-channel overflow flags
+ * - single-shot / periodic capacitance conversion with FLAG_CCVT (OS of a
+ *   single shot returns to stop when it ends), temperature conversion with
+ *   FLAG_TCVT
+ * - conversion timing derived from C_CMD, DIV_CFG and the FIN cycle count N
+ *
+ * Time is virtual: every bus transaction advances the clock of its bus by the
+ * time the transfer takes at the configured SCL rate, and the host advances it
+ * explicitly with MC1081_SimBusAdvance() when it would sleep.
+ *
+ * Conversion model (used for both timing and counts):
+ *   f_in  = I_osc / (2 * (C + C_par) * V_osc)
+ *   t_ch  = (settle + N * 2^FINDIV) / f_in            per averaging cycle
+ *   count = N * 2^FINDIV * (f_ref / 2^FREFDIV) / f_in
+ * A frame converts every enabled channel CAVG times. Counts above 0xFFFF
+ * saturate and set the channel's overflow flag.
+ */
+#ifndef __MC1081_SIM_H__
+#define __MC1081_SIM_H__
+
+#include "MC1081_types.h"
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/** @brief Maximum number of simulated devices on one simulated bus */
+#define MC1081_SIM_BUS_MAX_DEV (4)
+
+/** @brief Default reference clock of the model */
+#define MC1081_SIM_FREF_HZ MC1081_FREF_HZ
+
+/**
+ * @brief Synthetic waveform shape
+ */
+typedef enum
+{
+    MC1081_SIM_WAVE_CONST,    /**< base */
+    MC1081_SIM_WAVE_SINE,     /**< base + amp * sin(2*pi*t/period) */
+    MC1081_SIM_WAVE_SQUARE,   /**< base + amp during the first half of each period (touch pulses) */
+    MC1081_SIM_WAVE_TRIANGLE, /**< base ~ base + amp ~ base over one period */
+} MC1081_SimWaveType_t;
+
+/**
+ * @brief Synthetic waveform description
+ *
+ * Channel waveforms are in fF, the temperature waveform is in m°C.
+ */
+typedef struct
+{
+    MC1081_SimWaveType_t type; /**< Waveform shape */
+    int32_t base;              /**< Offset value */
+    int32_t amp;               /**< Amplitude */
+    uint32_t period_us;        /**< Period, 0 behaves as MC1081_SIM_WAVE_CONST */
+    uint32_t noise;            /**< Peak uniform noise added to each sample */
+} MC1081_SimWave_t;
+
+/**
+ * @brief Simulated MC1081 device
+ *
+ * Configure the public fields after MC1081_SimInit(), before the first transfer.
+ */
+typedef struct
+{
+    uint8_t addr; /**< 7-bit I2C address */
+
+    MC1081_SimWave_t ch[MC1081_CH_NUM];   /**< Single-ended / differential channel capacitance, fF */
+    MC1081_SimWave_t mch[MC1081_MCH_NUM]; /**< Mutual channel capacitance, fF */
+    MC1081_SimWave_t temp;                /**< Die temperature, m°C */
+    int32_t drift_ppm;                    /**< Capacitance drift per °C away from 25 °C, ppm */
+    uint32_t cpar_ff;                     /**< Parasitic capacitance added to every channel, fF */
+    uint32_t fref_hz;                     /**< Reference clock */
+    uint32_t vdd_mv;                      /**< Supply voltage, for VDD relative amplitudes */
+    uint32_t seed;                        /**< Noise generator state */
+
+    /* Internal state */
+    uint8_t regs[0x27];     /**< Register file 0x00 ~ 0x26 */
+    uint8_t ptr;            /**< Register pointer */
+    uint8_t cap_run;        /**< 1: capacitance conversion scheduled */
+    uint8_t temp_run;       /**< 1: temperature conversion scheduled */
+    uint64_t cap_start_ns;  /**< Start of the frame being converted */
+    uint64_t cap_done_ns;   /**< End of the frame being converted */
+    uint64_t temp_done_ns;  /**< End of the temperature conversion */
+    uint32_t frames;        /**< Completed capacitance frames */
+} MC1081_Sim_t;
+
+/**
+ * @brief Simulated I2C bus, the ctx of the MC1081_Bus_t it provides
+ */
+typedef struct
+{
+    MC1081_Sim_t *dev[MC1081_SIM_BUS_MAX_DEV]; /**< Attached devices */
+    uint8_t num;                               /**< Number of attached devices */
+    uint32_t scl_hz;                           /**< SCL rate used to advance time, 0: transfers take no time */
+    uint64_t now_ns;                           /**< Virtual time */
+
+    uint32_t fault_every; /**< Every n-th transfer to a device is faulty, 0: none */
+    int fault;            /**< MC1081_BUS_* code of a faulty transfer */
+    uint32_t stall_us;    /**< Clock stretching of a faulty transfer with MC1081_BUS_TIMEOUT */
+    uint32_t xfers;       /**< Transfers to a device so far, counts towards fault_every */
+    uint64_t deadline_ns; /**< Set by MC1081_SimBusDeadline(), 0: none */
+} MC1081_SimBus_t;
+
+/**
+ * @brief Initializes a simulated device with power-on register values and 10 pF constant channels.
+ * @param sim  [out] Device to initialize.
+ * @param addr [in]  7-bit I2C address it answers to.
+ */
+extern void MC1081_SimInit(MC1081_Sim_t *sim, uint8_t addr);
+
+/**
+ * @brief Initializes an empty simulated bus.
+ * @param bus    [out] Bus to initialize.
+ * @param scl_hz [in]  SCL rate used to advance virtual time per transfer.
+ */
+extern void MC1081_SimBusInit(MC1081_SimBus_t *bus, uint32_t scl_hz);
+
+/**
+ * @brief Attaches a device to a simulated bus.
+ * @return MC1081_Status_t MC1081_PARAM_ERR if the bus is full or the address is taken.
+ */
+extern MC1081_Status_t MC1081_SimBusAttach(MC1081_SimBus_t *bus, MC1081_Sim_t *sim);
+
+/**
+ * @brief Fills a driver bus interface that talks to the simulated bus.
+ * @param bus [in]  Simulated bus.
+ * @param out [out] Interface for MC1081_InitBus() / MC1081_InitStatic().
+ */
+extern void MC1081_SimBusInterface(MC1081_SimBus_t *bus, MC1081_Bus_t *out);
+
+/**
+ * @brief Advances virtual time, e.g. where the host would sleep.
+ */
+extern void MC1081_SimBusAdvance(MC1081_SimBus_t *bus, uint64_t ns);
+
+/**
+ * @brief Bus write callback, ctx is a MC1081_SimBus_t.
+ * @note Returns MC1081_BUS_ADDR_NACK when no device acknowledges. Every fault_every-th transfer
+ *       fails with `fault`: an address NACK leaves the device untouched, a data NACK sets the
+ *       register pointer and writes nothing, a timeout stretches the clock by stall_us and,
+ *       when that passes the deadline, aborts at the deadline without effect.
+ */
+extern int MC1081_SimBusWrite(void *ctx, uint8_t addr, const uint8_t *data, size_t len);
+
+/**
+ * @brief Bus read callback, ctx is a MC1081_SimBus_t.
+ * @note Faults as for MC1081_SimBusWrite(); a read ending in a data NACK still advances the
+ *       register pointer by len.
+ */
+extern int MC1081_SimBusRead(void *ctx, uint8_t addr, uint8_t *dst, size_t len);
+
+/**
+ * @brief Bus delay callback, ctx is a MC1081_SimBus_t. Advances virtual time.
+ */
+extern void MC1081_SimBusDelay(void *ctx, uint32_t us);
+
+/**
+ * @brief Deadline callback of MC1081_Bus_t, ctx is a MC1081_SimBus_t. Bounds stalled transfers.
+ */
+extern void MC1081_SimBusDeadline(void *ctx, uint64_t deadline_ns);
+
+/**
+ * @brief Clock callback for MC1081_SetClock(), ctx is a MC1081_SimBus_t. Returns the virtual time.
+ */
+extern uint64_t MC1081_SimBusClock(void *ctx);
+
+/**
+ * @brief Selects the bus served by MC1081_SimTransmit() / MC1081_SimReceive().
+ * @note The legacy callbacks carry no address, they access the first attached device.
+ */
+extern void MC1081_SimSetLegacyBus(MC1081_SimBus_t *bus);
+
+/**
+ * @brief Legacy MC1081_TransmitFunc_t backed by the bus given to MC1081_SimSetLegacyBus().
+ */
+extern int MC1081_SimTransmit(const uint8_t *data, const size_t len);
+
+/**
+ * @brief Legacy MC1081_ReceiveFunc_t backed by the bus given to MC1081_SimSetLegacyBus().
+ */
+extern int MC1081_SimReceive(const uint8_t *dst, const size_t len);
+
+/**
+ * @brief Time one frame takes with the device's current configuration.
+ * @return Frame conversion time in ns, 0 if no channel is enabled.
+ */
+extern uint64_t MC1081_SimFrameTimeNs(const MC1081_Sim_t *sim);
+
+#ifdef __linux__
+
+struct i2c_msg;
+
+/**
+ * @brief MC1081_LinuxXferFunc_t running a message list on a simulated bus, ctx is a MC1081_SimBus_t.
+ * @note Each message becomes one simulated transfer; a failed message ends the list with a
+ *       negative errno value, as the I2C_RDWR ioctl would.
+ */
+extern int MC1081_SimLinuxXfer(void *ctx, struct i2c_msg *msgs, uint32_t num);
+
+#endif
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,194 @@
+/**
+ * @file MC1081_touch.h
+ * @author https://github.com/xfp23
+ * @brief Baseline tracking and touch / proximity detection, as a frame stage.
+ * @version 0.1
+ * @date 2026-02-05
+ *
+ * @copyright Copyright (c) 2026
+ *
+ * Every lane (the 11 channel counts followed by the 5 mutual channel counts)
+ * keeps a baseline that follows slow drift through a first-order IIR. The
+ * signal is delta = count - baseline, negated for inverted lanes (mutual
+ * channels, whose capacitance drops on touch). A lane moves between three
+ * levels:
+ *
+ *   IDLE  --(delta >= prox_th)-->   PROX  --(delta >= touch_th)-->        TOUCH
+ *   IDLE  <--(delta < prox_th - hyst)-- PROX <--(delta < touch_th - hyst)-- TOUCH
+ *
+ * A level change is accepted after debounce_on (rising) or debounce_off
+ * (falling) consecutive frames. The baseline only adapts while the lane is
+ * IDLE with no rise pending, so it is frozen under a finger. Deltas below
+ * the baseline recover with a faster rate, and a lane held active for
+ * max_on frames is recalibrated to the current count.
+ *
+ * Per lane and frame the work is a few compares and one shift, with no
+ * division, so the stage can run in the acquisition interrupt. Events are
+ * delivered through a callback from the same context.
+ */
+#ifndef __MC1081_TOUCH_H__
+#define __MC1081_TOUCH_H__
+
+#include "MC1081.h"
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/** @brief Number of lanes: channels, then mutual channels */
+#define MC1081_TOUCH_LANES (MC1081_CH_NUM + MC1081_MCH_NUM)
+
+/** @brief Lane index of mutual channel k */
+#define MC1081_TOUCH_LANE_MCH(k) (MC1081_CH_NUM + (k))
+
+/** @brief Lane mask of every mutual channel */
+#define MC1081_TOUCH_MCH_LANES (0x1FU << MC1081_CH_NUM)
+
+/** @brief Default baseline time constant, 2^shift frames */
+#ifndef MC1081_TOUCH_BASE_SHIFT
+#define MC1081_TOUCH_BASE_SHIFT (8)
+#endif
+
+/** @brief Default time constant for deltas below the baseline, 2^shift frames */
+#ifndef MC1081_TOUCH_NEG_SHIFT
+#define MC1081_TOUCH_NEG_SHIFT (3)
+#endif
+
+/**
+ * @brief Detection level of a lane
+ */
+typedef enum
+{
+    MC1081_TOUCH_IDLE = 0x00, /**< Nothing near */
+    MC1081_TOUCH_PROX = 0x01, /**< Proximity */
+    MC1081_TOUCH_TOUCH = 0x02 /**< Touch */
+} MC1081_TouchLevel_t;
+
+/**
+ * @brief Detection events
+ */
+typedef enum
+{
+    MC1081_TOUCH_EV_PROX = 0x00,      /**< IDLE -> PROX */
+    MC1081_TOUCH_EV_TOUCH = 0x01,     /**< PROX -> TOUCH */
+    MC1081_TOUCH_EV_RELEASE = 0x02,   /**< TOUCH -> PROX */
+    MC1081_TOUCH_EV_PROX_LEAVE = 0x03 /**< PROX -> IDLE */
+} MC1081_TouchEvent_t;
+
+/**
+ * @brief Event callback
+ * @param user  [in] Pointer given to MC1081_TouchInit().
+ * @param lane  [in] Lane index.
+ * @param ev    [in] Event.
+ * @param delta [in] Delta of the frame that caused the event, counts.
+ * @note Called from the stage, i.e. from the context acquiring frames. A jump
+ *       over a level reports both steps (PROX then TOUCH, RELEASE then PROX_LEAVE).
+ */
+typedef void (*MC1081_TouchEventFunc_t)(void *user, uint8_t lane, MC1081_TouchEvent_t ev, int32_t delta);
+
+/**
+ * @brief Detection settings of a lane
+ */
+typedef struct
+{
+    uint16_t prox_th;     /**< Proximity threshold, counts, > 0 */
+    uint16_t touch_th;    /**< Touch threshold, counts, >= prox_th */
+    uint16_t hyst;        /**< Hysteresis below each threshold, counts, < prox_th */
+    uint8_t debounce_on;  /**< Frames needed to rise a level */
+    uint8_t debounce_off; /**< Frames needed to fall a level */
+    uint16_t max_on;      /**< Frames an active lane may last before recalibration, 0: unlimited */
+    uint8_t invert;       /**< 1: touch lowers the count (mutual channels) */
+} MC1081_TouchCfg_t;
+
+/**
+ * @brief Detection state, also the context of its stage
+ */
+typedef struct
+{
+    MC1081_Stage_t stage;          /**< Pipeline node used by MC1081_TouchAttach() */
+    MC1081_TouchEventFunc_t event; /**< Event callback, may be NULL */
+    void *user;                    /**< Passed to event */
+
+    uint16_t enabled; /**< Bit n set: lane n is configured */
+    uint16_t primed;  /**< Bit n set: lane n has a baseline */
+    uint16_t invert;  /**< Bit n set: lane n is inverted */
+    uint16_t prox;    /**< Bit n set: lane n is at PROX or TOUCH */
+    uint16_t touch;   /**< Bit n set: lane n is at TOUCH */
+    uint8_t base_shift; /**< Baseline time constant, 2^shift frames */
+    uint8_t neg_shift;  /**< Time constant below the baseline, 2^shift frames */
+
+    /* 每通道配置 */
+    uint16_t prox_th[MC1081_TOUCH_LANES];
+    uint16_t touch_th[MC1081_TOUCH_LANES];
+    uint16_t hyst[MC1081_TOUCH_LANES];
+    uint8_t debounce_on[MC1081_TOUCH_LANES];
+    uint8_t debounce_off[MC1081_TOUCH_LANES];
+    uint16_t max_on[MC1081_TOUCH_LANES];
+
+    /* 每通道状态 */
+    uint32_t base_q16[MC1081_TOUCH_LANES]; /**< Baseline, Q16.16 counts */
+    int32_t delta[MC1081_TOUCH_LANES];     /**< Last delta, counts */
+    uint8_t level[MC1081_TOUCH_LANES];     /**< MC1081_TouchLevel_t */
+    uint8_t deb_cnt[MC1081_TOUCH_LANES];   /**< Frames the pending level change has lasted */
+    uint16_t on_cnt[MC1081_TOUCH_LANES];   /**< Frames spent above IDLE */
+} MC1081_Touch_t;
+
+/**
+ * @brief Initializes the detector with no lane enabled.
+ * @param touch [out] State.
+ * @param event [in]  Event callback, may be NULL (poll prox / touch instead).
+ * @param user  [in]  Passed to the callback.
+ */
+extern void MC1081_TouchInit(MC1081_Touch_t *touch, MC1081_TouchEventFunc_t event, void *user);
+
+/**
+ * @brief Enables and configures lanes. Their baseline restarts from the next count.
+ * @param touch [in] State.
+ * @param lanes [in] Lane mask (bit n: lane n).
+ * @param cfg   [in] Settings.
+ * @return MC1081_Status_t MC1081_PARAM_ERR for inconsistent thresholds.
+ */
+extern MC1081_Status_t MC1081_TouchSetLanes(MC1081_Touch_t *touch, uint16_t lanes, const MC1081_TouchCfg_t *cfg);
+
+/**
+ * @brief Disables lanes.
+ */
+extern void MC1081_TouchDisableLanes(MC1081_Touch_t *touch, uint16_t lanes);
+
+/**
+ * @brief Sets the baseline adaptation rates.
+ * @param touch      [in] State.
+ * @param base_shift [in] Time constant, 2^base_shift frames, 1 ~ 15.
+ * @param neg_shift  [in] Time constant for deltas below the baseline, 1 ~ 15.
+ * @return MC1081_Status_t Operation status code.
+ */
+extern MC1081_Status_t MC1081_TouchSetBaselineRate(MC1081_Touch_t *touch, uint8_t base_shift, uint8_t neg_shift);
+
+/**
+ * @brief Drops the baseline of lanes; the next count becomes their baseline.
+ * @note Active lanes return to IDLE without events.
+ */
+extern void MC1081_TouchRecalibrate(MC1081_Touch_t *touch, uint16_t lanes);
+
+/**
+ * @brief Current baseline of a lane, counts.
+ */
+extern uint16_t MC1081_TouchBaseline(const MC1081_Touch_t *touch, uint8_t lane);
+
+/**
+ * @brief Processes one frame. This is the stage function.
+ * @return true (never drops a frame).
+ */
+extern bool MC1081_TouchStage(void *touch, MC1081_Snapshot_t *snap);
+
+/**
+ * @brief Appends the detector to a handle's frame pipeline.
+ */
+extern MC1081_Status_t MC1081_TouchAttach(MC1081_Handle_t handle, MC1081_Touch_t *touch);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -22,20 +22,56 @@ extern "C"
 {
 #endif
 
+/**
+ * @brief Handle storage selection
+ *
+ * - 1: MC1081_Init() / MC1081_InitBus() allocate handles with calloc()
+ * - 0: handles come from a static pool of MC1081_HANDLE_POOL_SIZE entries,
+ *      the driver does not reference the heap at all; slots are claimed with
+ *      an atomic compare-and-swap, so handles may be created from several
+ *      threads
+ */
+#ifndef MC1081_USE_HEAP
+#define MC1081_USE_HEAP (1)
+#endif
+
+/** @brief Number of handles in the static pool (used when MC1081_USE_HEAP is 0) */
+#ifndef MC1081_HANDLE_POOL_SIZE
+#define MC1081_HANDLE_POOL_SIZE (4)
+#endif
+
+/**
+ * @brief Per-handle statistics, see MC1081_StatsGet()
+ *
+ * - 1: every handle counts transfers, bytes, errors and frames, and keeps
+ *      latency histograms while a clock is set (MC1081_SetClock())
+ * - 0: the counters are removed from the handle and from every transfer,
+ *      MC1081_StatsGet() returns MC1081_ERR
+ */
+#ifndef MC1081_USE_STATS
+#define MC1081_USE_STATS (1)
+#endif
+
 /**
  * @brief Driver return status definition
  *
  * Note:
- * - MC1081_MEM_ERR is only expected to be returned by MC1081_Init()
+ * - MC1081_MEM_ERR is only expected to be returned by MC1081_Init() / MC1081_InitBus()
  */
 typedef enum
 {
-    MC1081_OK,        /**< Operation successful */
-    MC1081_ERR,       /**< Generic error */
-    MC1081_PARAM_ERR, /**< Invalid parameter */
-    MC1081_WR_ERR,    /**< Register write error */
-    MC1081_RR_ERR,    /**< Register read error */
-    MC1081_MEM_ERR,   /**< Memory allocation failure */
+    MC1081_OK,            /**< Operation successful */
+    MC1081_ERR,           /**< Generic error */
+    MC1081_PARAM_ERR,     /**< Invalid parameter */
+    MC1081_WR_ERR,        /**< Register write error */
+    MC1081_RR_ERR,        /**< Register read error */
+    MC1081_MEM_ERR,       /**< Memory allocation failure */
+    MC1081_FULL_ERR,      /**< No free slot in a ring buffer */
+    MC1081_BUSY_ERR,      /**< An asynchronous request is still in flight */
+    MC1081_DROP_ERR,      /**< The frame was dropped by a processing stage */
+    MC1081_ADDR_NACK_ERR, /**< The device did not acknowledge its address */
+    MC1081_DATA_NACK_ERR, /**< The transfer failed in the data phase */
+    MC1081_TIMEOUT_ERR,   /**< A transfer stalled past its deadline, or the deadline had already passed */
 } MC1081_Status_t;
 
 /**
@@ -396,6 +432,24 @@ typedef struct
     MC1081_ActiveShieldSel_t sel;  /**< Idle-state selection */
 } MC1081_ActiveShielCfg;
 
+/**
+ * @brief Whole configuration block 0x1C ~ 0x26, see MC1081_DeviceConfigApply()
+ */
+typedef struct
+{
+    MC1081_TempConvState_t temp_state; /**< Temperature conversion on / off, applied last */
+    MC1081_TempTime_t temp_time;       /**< Temperature conversion time */
+    MC1081_CapConvConfig_t cap;        /**< Capacitance conversion, cap.start is applied last */
+    uint8_t fin_cycle;                 /**< FIN cycle count N */
+    MC1081_ClockCfg_t clock;           /**< Clock configuration */
+    MC1081_ChSingleEn_t ch_single;     /**< Single-ended channel enable */
+    MC1081_MchEn_t mch;                /**< Mutual channel enable */
+    MC1081_SingleOSCCfg_t osc1;        /**< Single-ended oscillator */
+    MC1081_ChDiffEn_t ch_diff;         /**< Differential channel enable */
+    MC1081_DiffOSCCfg_t osc2;          /**< Differential oscillator */
+    MC1081_ActiveShielCfg shield;      /**< Active shield */
+} MC1081_DeviceConfig_t;
+
 /**
  * @brief I2C address selection bitfield
  */
@@ -413,6 +467,121 @@ typedef union
     uint8_t value; /**< Raw address selection value */
 } MC1081_AddrSel_t;
 
+/** @brief Nominal reference clock, see MC1081_SetRefClock() */
+#ifndef MC1081_FREF_HZ
+#define MC1081_FREF_HZ (8000000UL)
+#endif
+
+/** @brief Oscillator frequency assumed by the conversion time predictor before any count is known */
+#ifndef MC1081_FIN_NOMINAL_HZ
+#define MC1081_FIN_NOMINAL_HZ (1000000UL)
+#endif
+
+/** @brief Safety margin added to a predicted conversion time, percent */
+#ifndef MC1081_PREDICT_MARGIN_PCT
+#define MC1081_PREDICT_MARGIN_PCT (3)
+#endif
+
+/** @brief Extra confirmation reads MC1081_AcquireWhenReady() may do when a prediction was short */
+#ifndef MC1081_ACQ_MAX_RETRY
+#define MC1081_ACQ_MAX_RETRY (4)
+#endif
+
+/**
+ * @brief Unchanged registers MC1081_DeviceConfigUpdate() rewrites to join two writes into one
+ *
+ * Rewriting a register costs one byte on the bus, a separate write costs
+ * the address and register bytes plus start / stop.
+ */
+#ifndef MC1081_CFG_MERGE_GAP
+#define MC1081_CFG_MERGE_GAP (2)
+#endif
+
+/** @brief Number of result registers (0x00 ~ 0x1B) */
+#define MC1081_RESULT_REG_NUM (28)
+
+/** @brief Number of configuration registers (0x1C ~ 0x26) */
+#define MC1081_CFG_REG_NUM (11)
+
+/** @brief Number of single-ended / differential channel data words */
+#define MC1081_CH_NUM (11)
+
+/** @brief Number of mutual-capacitance channels */
+#define MC1081_MCH_NUM (5)
+
+/**
+ * @brief Decoded copy of the whole result block (0x00 ~ 0x1B)
+ *
+ * Filled by MC1081_ReadSnapshot() from a single burst read.
+ */
+typedef struct
+{
+    uint16_t temp;                /**< Raw temperature value */
+    uint16_t ch[MC1081_CH_NUM];   /**< Channel counts, indexed by MC1081_Channel_Single_t / MC1081_Channel_Diff_t */
+    uint16_t mch[MC1081_MCH_NUM]; /**< Mutual capacitance counts, indexed by MC1081_Channel_MCH_t */
+    uint16_t of_single;           /**< OSC1 overflow bitmap: bit 0~9 channels, bit 10 REF, bit 11~15 MCH */
+    uint8_t of_diff;              /**< OSC2 overflow bitmap: bit 0~4 channels, bit 5 REF */
+    uint8_t isCapConverting;      /**< 1: capacitance conversion busy */
+    uint8_t isTempConverting;     /**< 1: temperature conversion busy */
+} MC1081_Snapshot_t;
+
+/**
+ * @brief Times of one read, from the clock given to MC1081_SetClock(), 0 without a clock
+ */
+typedef struct
+{
+    uint64_t request_ns; /**< Before the first bus transfer of the read */
+    uint64_t bus_ns;     /**< After the last bus transfer, before the stages run */
+    uint64_t conv_ns;    /**< Estimated end of the conversion that produced the data */
+} MC1081_FrameTime_t;
+
+/**
+ * @brief Timestamped acquisition frame
+ */
+typedef struct
+{
+    uint64_t timestamp;      /**< Capture time, in the unit of the caller's clock */
+    MC1081_FrameTime_t time; /**< Request, bus completion and conversion times */
+    MC1081_Snapshot_t data;  /**< Temperature, channel counts, overflow bits and status */
+} MC1081_Frame_t;
+
+/** @brief Scan plan option: read the temperature word */
+#define MC1081_SCAN_TEMP (0x01U)
+
+/** @brief Scan plan option: read the overflow bitmaps and the status register */
+#define MC1081_SCAN_FLAGS (0x02U)
+
+/**
+ * @brief Scan plan option: the bus reads all bursts in one combined transfer
+ *        (MC1081_Bus_t::ReadRegs set), so a burst costs a pointer write and a repeated
+ *        start instead of a whole transaction
+ */
+#define MC1081_SCAN_COMBINED (0x04U)
+
+/** @brief Most bursts a scan plan can hold */
+#define MC1081_SCAN_MAX_BURSTS (8)
+
+/**
+ * @brief One auto-increment read of a scan plan
+ */
+typedef struct
+{
+    uint8_t reg; /**< First register */
+    uint8_t len; /**< Number of registers */
+} MC1081_ScanBurst_t;
+
+/**
+ * @brief Cached set of burst reads covering the enabled channels, see MC1081_ScanPlanMake()
+ */
+typedef struct
+{
+    MC1081_ScanBurst_t burst[MC1081_SCAN_MAX_BURSTS]; /**< Reads, in address order */
+    uint8_t num;                                      /**< Number of reads */
+    uint8_t bytes;                                    /**< Registers read per frame */
+    uint32_t need;                                    /**< Bit n set: result register n is needed */
+    uint32_t cost_ns;                                 /**< Estimated bus time per frame */
+} MC1081_ScanPlan_t;
+
 /**
  * @brief Low-level transmit function prototype
  */
@@ -423,6 +592,11 @@ typedef int (*MC1081_TransmitFunc_t)(const uint8_t *data, const size_t len);
  */
 typedef int (*MC1081_ReceiveFunc_t)(const uint8_t *dst, const size_t len);
 
+/**
+ * @brief Blocking delay prototype
+ */
+typedef void (*MC1081_DelayFunc_t)(uint32_t us);
+
 /**
  * @brief Communication interface configuration
  */
@@ -430,15 +604,314 @@ typedef struct
 {
     MC1081_TransmitFunc_t Transmit; /**< Transmit callback */
     MC1081_ReceiveFunc_t Receive;   /**< Receive callback */
+    MC1081_DelayFunc_t Delay;       /**< Optional delay, needed by MC1081_AcquireWhenReady() */
 } MC1081_Conf_t;
 
+/** @brief Histogram buckets per power of two, as a shift */
+#ifndef MC1081_LAT_SUB_BITS
+#define MC1081_LAT_SUB_BITS (3)
+#endif
+
+/** @brief Buckets of one histogram, covering 0 ~ UINT32_MAX ns */
+#define MC1081_LAT_BINS ((32 - MC1081_LAT_SUB_BITS + 1) << MC1081_LAT_SUB_BITS)
+
+/**
+ * @brief Latency histogram, shared by the driver statistics and MC1081_latency.h
+ *
+ * Log-linear: 2^MC1081_LAT_SUB_BITS buckets per power of two, so a percentile
+ * is exact below 2^MC1081_LAT_SUB_BITS ns and at most 1 / 2^MC1081_LAT_SUB_BITS
+ * too high above. Recording is a bit scan and an increment, with no allocation
+ * and no division. Values are clamped to UINT32_MAX ns (4.29 s).
+ */
+typedef struct
+{
+    uint32_t bin[MC1081_LAT_BINS]; /**< Samples per bucket */
+    uint32_t count;                /**< Number of samples */
+    uint32_t min_ns;               /**< Smallest sample */
+    uint32_t max_ns;               /**< Largest sample */
+} MC1081_LatHist_t;
+
+/**
+ * @brief Operation class of a statistics histogram
+ */
+typedef enum
+{
+    MC1081_OP_WRITE, /**< Register write transfer */
+    MC1081_OP_READ,  /**< Register read: pointer write and read transfer */
+    MC1081_OP_FRAME, /**< Whole frame read, MC1081_FrameTime_t request to bus completion */
+    MC1081_OP_NUM,
+} MC1081_OpClass_t;
+
+/**
+ * @brief Driver statistics of one handle; counters wrap around
+ */
+typedef struct
+{
+    uint32_t tx;          /**< Bus transfers started, blocking and non-blocking */
+    uint32_t wr_bytes;    /**< Bytes written, register address included */
+    uint32_t rd_bytes;    /**< Bytes read */
+    uint32_t wr_err;      /**< Failed write transfers */
+    uint32_t rd_err;      /**< Failed read transfers */
+    uint32_t busy_err;    /**< Conversions not finished in time, see MC1081_AcquireWhenReady() */
+    uint32_t busy_polls;  /**< Frames read again because STATUS still showed the single shot busy */
+    uint32_t retries;     /**< Transfers repeated by the retry policy, see MC1081_SetRetryPolicy() */
+    uint32_t frames;      /**< Frames decoded */
+    uint32_t conversions; /**< Conversions seen to end: FLAG_CCVT / FLAG_TCVT busy -> idle between STATUS reads */
+    uint32_t overflows;   /**< Frames with an overflow bit set */
+    uint32_t drops;       /**< Frames dropped by a stage */
+    uint32_t addr_nack;   /**< Transfers failed on the address phase */
+    uint32_t data_nack;   /**< Transfers failed on the data phase */
+    uint32_t timeouts;    /**< Transfers stalled past their deadline */
+    uint32_t deadlines;   /**< Operations refused or not retried because the deadline had passed */
+
+    MC1081_LatHist_t hist[MC1081_OP_NUM]; /**< Latency histograms, filled while a clock is set */
+} MC1081_Stats_t;
+
+/**
+ * @brief Monotonic clock prototype
+ * @param ctx User context given to MC1081_SetClock()
+ * @return Current time in ns; any origin, never going backwards
+ */
+typedef uint64_t (*MC1081_ClockFunc_t)(void *ctx);
+
+/**
+ * @brief Bus callback results
+ *
+ * Transports that can tell where a transfer failed return these codes, the
+ * driver reports them as MC1081_ADDR_NACK_ERR / MC1081_DATA_NACK_ERR /
+ * MC1081_TIMEOUT_ERR. Any other non-zero value is reported as
+ * MC1081_WR_ERR / MC1081_RR_ERR.
+ */
+#define MC1081_BUS_OK (0)
+#define MC1081_BUS_ADDR_NACK (1) /**< Address byte not acknowledged */
+#define MC1081_BUS_DATA_NACK (2) /**< Data byte not acknowledged, or the read aborted */
+#define MC1081_BUS_TIMEOUT (3)   /**< Clock stretching or arbitration lasted past the deadline */
+
+/** @brief Retry policy: failures worth another attempt */
+#define MC1081_RETRY_ON_ADDR_NACK (0x01U)
+#define MC1081_RETRY_ON_DATA_NACK (0x02U)
+#define MC1081_RETRY_ON_TIMEOUT (0x04U)
+#define MC1081_RETRY_ON_OTHER (0x08U) /**< MC1081_WR_ERR / MC1081_RR_ERR */
+#define MC1081_RETRY_ON_ALL (0x0FU)
+
+/**
+ * @brief Transfer retry and deadline policy, see MC1081_SetRetryPolicy()
+ *
+ * A register operation is one write, or one register pointer write followed
+ * by its read. A failed read is retried together with its pointer write,
+ * since the chip's pointer may have moved.
+ */
+typedef struct
+{
+    uint8_t retries;         /**< Extra attempts of a failed transfer, 0: report the first failure */
+    uint8_t retry_on;        /**< MC1081_RETRY_ON_* bits */
+    uint32_t backoff_us;     /**< Delay before the first retry, doubled on every further one, 0: none */
+    uint32_t backoff_max_us; /**< Upper bound of the delay, 0: unbounded */
+    uint32_t op_timeout_us;  /**< Time budget of one register operation with its retries, 0: none */
+} MC1081_RetryPolicy_t;
+
+/**
+ * @brief Context-carrying bus write prototype
+ * @param ctx  User context given in MC1081_Bus_t
+ * @param addr 7-bit I2C device address
+ * @return 0 on success, a MC1081_BUS_* code or any other non-zero value on failure
+ */
+typedef int (*MC1081_BusWriteFunc_t)(void *ctx, uint8_t addr, const uint8_t *data, size_t len);
+
+/**
+ * @brief Context-carrying bus read prototype
+ * @param ctx  User context given in MC1081_Bus_t
+ * @param addr 7-bit I2C device address
+ * @return 0 on success, non-zero on failure
+ */
+typedef int (*MC1081_BusReadFunc_t)(void *ctx, uint8_t addr, uint8_t *dst, size_t len);
+
+/**
+ * @brief Combined register read prototype
+ *
+ * For every burst the register pointer is written and burst.len bytes are read
+ * after a repeated start, without a STOP in between. The data of all bursts go
+ * to dst back to back. The transport should issue the list as one bus
+ * transaction where it can (e.g. one I2C_RDWR ioctl on Linux).
+ * @param ctx   User context given in MC1081_Bus_t
+ * @param addr  7-bit I2C device address
+ * @param burst Register pointer and length of every read
+ * @param num   Number of bursts, at least 1
+ * @param dst   Sum of the burst lengths in bytes
+ * @return 0 on success, a MC1081_BUS_* code or any other non-zero value on failure
+ */
+typedef int (*MC1081_BusReadRegsFunc_t)(void *ctx, uint8_t addr, const MC1081_ScanBurst_t *burst, uint8_t num, uint8_t *dst);
+
+/**
+ * @brief Transfer deadline prototype
+ * @param ctx         User context given in MC1081_Bus_t
+ * @param deadline_ns Time by which the next transfer must end, clock of MC1081_SetClock(); 0: none.
+ *                    A transport that cannot finish in time aborts and returns MC1081_BUS_TIMEOUT.
+ */
+typedef void (*MC1081_BusDeadlineFunc_t)(void *ctx, uint64_t deadline_ns);
+
+/**
+ * @brief Context-carrying blocking delay prototype
+ * @param ctx User context given in MC1081_Bus_t
+ * @param us  Time to wait in microseconds
+ */
+typedef void (*MC1081_BusDelayFunc_t)(void *ctx, uint32_t us);
+
+/**
+ * @brief Bus interface shared by any number of devices
+ *
+ * One adapter (and one ctx) can serve every MC1081 on the bus,
+ * the device is selected by the address passed with each call.
+ */
+typedef struct
+{
+    void *ctx;                         /**< User context passed back to every call */
+    MC1081_BusWriteFunc_t Write;       /**< Write callback */
+    MC1081_BusReadFunc_t Read;         /**< Read callback */
+    MC1081_BusDelayFunc_t Delay;       /**< Optional delay, needed by MC1081_AcquireWhenReady() */
+    MC1081_BusDeadlineFunc_t Deadline; /**< Optional, told the deadline before every transfer while one applies */
+    MC1081_BusReadRegsFunc_t ReadRegs; /**< Optional combined read, replaces Write + Read of every register read */
+} MC1081_Bus_t;
+
+/**
+ * @brief Non-blocking bus write prototype
+ *
+ * Starts the transfer and returns at once. When the transfer ends (e.g. in the
+ * DMA complete interrupt) the transport calls MC1081_AsyncOnComplete().
+ * The data buffer stays valid until then.
+ * @return 0 if the transfer was started, non-zero otherwise
+ */
+typedef int (*MC1081_BusStartWriteFunc_t)(void *ctx, uint8_t addr, const uint8_t *data, size_t len);
+
+/**
+ * @brief Non-blocking bus read prototype, see MC1081_BusStartWriteFunc_t
+ */
+typedef int (*MC1081_BusStartReadFunc_t)(void *ctx, uint8_t addr, uint8_t *dst, size_t len);
+
+/**
+ * @brief Non-blocking (DMA / interrupt driven) bus interface
+ */
+typedef struct
+{
+    void *ctx;                             /**< User context passed back to every call */
+    MC1081_BusStartWriteFunc_t StartWrite; /**< Start write callback */
+    MC1081_BusStartReadFunc_t StartRead;   /**< Start read callback */
+} MC1081_AsyncBus_t;
+
+/**
+ * @brief What an asynchronous request reads
+ */
+typedef enum
+{
+    MC1081_ASYNC_SNAPSHOT, /**< Whole result block, see MC1081_ReadSnapshot() */
+    MC1081_ASYNC_CHANNEL,  /**< One single-ended / differential channel, into ch[] */
+    MC1081_ASYNC_MCH,      /**< One mutual channel, into mch[] */
+    MC1081_ASYNC_STATUS,   /**< STATUS register, into the busy flags */
+} MC1081_AsyncKind_t;
+
+/**
+ * @brief Asynchronous request completion callback, called from the transport's completion context
+ * @param user  User pointer given to MC1081_AsyncStart()
+ * @param token Token of the finished request
+ * @param sta   Result of the request
+ */
+typedef void (*MC1081_AsyncDoneFunc_t)(void *user, uint32_t token, MC1081_Status_t sta);
+
+/**
+ * @brief Asynchronous request state kept in the handle
+ */
+typedef struct
+{
+    volatile uint8_t state;            /**< Driver state machine state */
+    uint8_t kind;                      /**< MC1081_AsyncKind_t of the request */
+    uint8_t ch;                        /**< Channel of the request */
+    uint8_t reg;                       /**< First register, also the buffer of the address phase */
+    uint8_t len;                       /**< Bytes of the data phase */
+    uint32_t token;                    /**< Token of the current / last request */
+    MC1081_Status_t sta;               /**< Result of the last request */
+    MC1081_Snapshot_t *out;            /**< Destination of the decoded data */
+    MC1081_AsyncDoneFunc_t done;       /**< Completion callback, may be NULL */
+    void *user;                        /**< Completion callback user pointer */
+    uint8_t buf[MC1081_RESULT_REG_NUM]; /**< DMA buffer of the data phase */
+} MC1081_AsyncCtx_t;
+
+/**
+ * @brief Frame processing stage
+ * @param ctx  User context given to MC1081_StageAttach()
+ * @param snap Frame, may be modified in place
+ * @return false to drop the frame; later stages do not run and the read returns MC1081_DROP_ERR
+ */
+typedef bool (*MC1081_StageFunc_t)(void *ctx, MC1081_Snapshot_t *snap);
+
+/**
+ * @brief Node of a handle's stage chain, storage owned by the caller
+ */
+typedef struct MC1081_Stage
+{
+    MC1081_StageFunc_t fn;     /**< Stage function */
+    void *ctx;                 /**< User context */
+    struct MC1081_Stage *next; /**< Next stage, managed by the driver */
+} MC1081_Stage_t;
+
+/**
+ * @brief Where the object storage of a handle comes from
+ */
+typedef enum
+{
+    MC1081_OBJ_HEAP,   /**< Allocated by calloc() */
+    MC1081_OBJ_POOL,   /**< Taken from the static handle pool */
+    MC1081_OBJ_STATIC, /**< Provided by the caller, see MC1081_InitStatic() */
+    MC1081_OBJ_FREE,   /**< Released by MC1081_DeInit(), no longer a valid handle */
+} MC1081_ObjOrigin_t;
+
+/**
+ * @brief State of an acquisition started by MC1081_AcquireBegin()
+ */
+typedef enum
+{
+    MC1081_ACQ_IDLE,     /**< None pending */
+    MC1081_ACQ_SINGLE,   /**< Single shot started, STATUS confirms completion */
+    MC1081_ACQ_PERIODIC, /**< Periodic conversion, one full interval awaited */
+} MC1081_AcqState_t;
+
 /**
  * @brief MC1081 object instance
  */
 typedef struct
 {
-    MC1081_Conf_t conf; /**< Communication configuration */
+    MC1081_Conf_t conf; /**< Communication configuration (legacy callbacks) */
+    MC1081_Bus_t bus;   /**< Bus interface used for every transfer */
     uint8_t I2c_addr;   /**< I2C device address */
+    uint8_t origin;     /**< Storage origin, see MC1081_ObjOrigin_t */
+    uint32_t fref_hz;   /**< Reference clock used for conversion time prediction */
+
+    uint8_t shadow[MC1081_CFG_REG_NUM]; /**< Write-through copy of registers 0x1C ~ 0x26 */
+    uint16_t shadow_valid;              /**< Bit n set: shadow[n] matches the chip */
+
+    MC1081_AsyncBus_t abus;   /**< Non-blocking bus, see MC1081_AsyncAttach() */
+    MC1081_AsyncCtx_t async;  /**< Asynchronous request state */
+
+    MC1081_Stage_t *stages; /**< Frame processing stages, see MC1081_StageAttach() */
+
+    MC1081_ClockFunc_t clock; /**< Timestamp clock, see MC1081_SetClock() */
+    void *clock_ctx;          /**< Context passed to clock */
+    uint64_t period_ns;       /**< Frame period assumed by the conversion time estimate */
+    MC1081_FrameTime_t time;  /**< Times of the last read */
+    uint64_t acq_start_ns;    /**< Start of the acquisition pending in MC1081_AcquireFinish() */
+    uint32_t acq_wait_us;     /**< Predicted wait of that acquisition */
+    uint8_t acq_state;        /**< MC1081_AcqState_t */
+    uint8_t acq_temp;         /**< T_CMD STC of that acquisition: FLAG_TCVT also confirms a single shot */
+
+    MC1081_RetryPolicy_t retry; /**< Retry policy, see MC1081_SetRetryPolicy() */
+    uint64_t deadline_ns;       /**< Absolute deadline, see MC1081_SetDeadline() */
+    uint64_t op_deadline_ns;    /**< Deadline of the current register operation, 0: none */
+    uint8_t reg_ptr;            /**< Register pointer of the current operation, resent on a read retry */
+
+#if MC1081_USE_STATS
+    MC1081_Stats_t stats;  /**< Statistics, see MC1081_StatsGet() */
+    uint8_t stats_busy;    /**< FLAG_CCVT / FLAG_TCVT as last read or implied by MC1081_AcquireBegin() */
+    uint64_t stats_t0;     /**< Start of the current register operation */
+#endif
 } MC1081_Obj_t;
 
 /**
@@ -1,5 +1,6 @@
 #include "MC1081.h"
 #include "MC1081_reg.h"
+#include "string.h"
 
 // mcor
 #define MC1081_CHECKPTR(x)     \
@@ -18,27 +19,502 @@
             return ret;       \
     } while (0)
 
+#define MC1081_LAT_SUB (1U << MC1081_LAT_SUB_BITS)
+#define MC1081_LAT_SUB_MASK (MC1081_LAT_SUB - 1U)
+
+/**
+ * @brief 读取时间戳时钟, 未设置时为 0
+ */
+static inline uint64_t ClockNow(MC1081_Handle_t handle)
+{
+    return (handle->clock != NULL) ? handle->clock(handle->clock_ctx) : 0;
+}
+
+#if MC1081_USE_STATS
+#define MC1081_STAT_ADD(h, field, n) ((h)->stats.field += (uint32_t)(n))
+#define MC1081_STAT_BEGIN(h) ((h)->stats_t0 = ClockNow(h))
+#define MC1081_STAT_TIME(h, op, from, to) StatTime((h), (op), (from), (to))
+#define MC1081_STAT_FRAME(h, snap) StatFrame((h), (snap))
+#define MC1081_STAT_STATUS(h, cap, temp) StatStatus((h), (cap), (temp))
+#define MC1081_STAT_ERR(h, sta) StatError((h), (sta))
+
+#define MC1081_STAT_BUSY_CAP (0x01U)
+#define MC1081_STAT_BUSY_TEMP (0x02U)
+
+/**
+ * @brief 记录一次操作的耗时, 未设置时钟时不记录
+ */
+static void StatTime(MC1081_Handle_t handle, MC1081_OpClass_t op, uint64_t from_ns, uint64_t to_ns)
+{
+    if (handle->clock == NULL)
+        return;
+
+    MC1081_LatHistAdd(&handle->stats.hist[op], (to_ns > from_ns) ? (to_ns - from_ns) : 0);
+}
+
+/**
+ * @brief 统计一帧
+ */
+static void StatFrame(MC1081_Handle_t handle, const MC1081_Snapshot_t *snap)
+{
+    handle->stats.frames++;
+
+    if (snap->of_single != 0 || snap->of_diff != 0)
+        handle->stats.overflows++;
+}
+
+/**
+ * @brief 统计读到的 STATUS: 转换标志由忙变闲即一次转换结束
+ */
+static void StatStatus(MC1081_Handle_t handle, uint8_t cap, uint8_t temp)
+{
+    const uint8_t busy = (uint8_t)((cap ? MC1081_STAT_BUSY_CAP : 0U) | (temp ? MC1081_STAT_BUSY_TEMP : 0U));
+    const uint8_t ended = (uint8_t)(handle->stats_busy & ~busy);
+
+    if (ended & MC1081_STAT_BUSY_CAP)
+        handle->stats.conversions++;
+    if (ended & MC1081_STAT_BUSY_TEMP)
+        handle->stats.conversions++;
+
+    handle->stats_busy = busy;
+}
+
+/**
+ * @brief 按出错阶段计数
+ */
+static void StatError(MC1081_Handle_t handle, MC1081_Status_t sta)
+{
+    switch (sta)
+    {
+    case MC1081_ADDR_NACK_ERR:
+        handle->stats.addr_nack++;
+        break;
+    case MC1081_DATA_NACK_ERR:
+        handle->stats.data_nack++;
+        break;
+    case MC1081_TIMEOUT_ERR:
+        handle->stats.timeouts++;
+        break;
+    default:
+        break;
+    }
+}
+#else
+#define MC1081_STAT_ADD(h, field, n) ((void)0)
+#define MC1081_STAT_BEGIN(h) ((void)0)
+#define MC1081_STAT_TIME(h, op, from, to) ((void)0)
+#define MC1081_STAT_FRAME(h, snap) ((void)0)
+#define MC1081_STAT_STATUS(h, cap, temp) ((void)0)
+#define MC1081_STAT_ERR(h, sta) ((void)0)
+#endif
+
+/**
+ * @brief 将总线回调的返回值映射为状态码, 无法区分阶段时返回 other
+ */
+static MC1081_Status_t BusStatus(int ret, MC1081_Status_t other)
+{
+    switch (ret)
+    {
+    case MC1081_BUS_OK:
+        return MC1081_OK;
+    case MC1081_BUS_ADDR_NACK:
+        return MC1081_ADDR_NACK_ERR;
+    case MC1081_BUS_DATA_NACK:
+        return MC1081_DATA_NACK_ERR;
+    case MC1081_BUS_TIMEOUT:
+        return MC1081_TIMEOUT_ERR;
+    default:
+        return other;
+    }
+}
+
+/**
+ * @brief 开始一次寄存器操作 (一次写, 或写寄存器指针 + 读), 确定其截止时间
+ * @return 绝对截止时间已过时返回 MC1081_TIMEOUT_ERR, 不访问总线
+ */
+static MC1081_Status_t OpBegin(MC1081_Handle_t handle)
+{
+    handle->op_deadline_ns = 0;
+
+    if (handle->clock == NULL || (handle->deadline_ns == 0 && handle->retry.op_timeout_us == 0))
+    {
+        MC1081_STAT_BEGIN(handle);
+        return MC1081_OK;
+    }
+
+    const uint64_t now = ClockNow(handle);
+#if MC1081_USE_STATS
+    handle->stats_t0 = now;
+#endif
+
+    uint64_t deadline = handle->deadline_ns;
+    if (handle->retry.op_timeout_us != 0)
+    {
+        const uint64_t op = now + (uint64_t)handle->retry.op_timeout_us * 1000ULL;
+        if (deadline == 0 || op < deadline)
+            deadline = op;
+    }
+
+    if (now >= deadline)
+    {
+        MC1081_STAT_ADD(handle, deadlines, 1);
+        return MC1081_TIMEOUT_ERR;
+    }
+
+    handle->op_deadline_ns = deadline;
+    return MC1081_OK;
+}
+
+/**
+ * @brief 失败后按策略决定是否重试, 需要时退避等待
+ * @return true: 再试一次
+ */
+static bool RetryWait(MC1081_Handle_t handle, MC1081_Status_t sta, uint8_t attempt)
+{
+    const MC1081_RetryPolicy_t *p = &handle->retry;
+
+    uint8_t kind = MC1081_RETRY_ON_OTHER;
+    if (sta == MC1081_ADDR_NACK_ERR)
+        kind = MC1081_RETRY_ON_ADDR_NACK;
+    else if (sta == MC1081_DATA_NACK_ERR)
+        kind = MC1081_RETRY_ON_DATA_NACK;
+    else if (sta == MC1081_TIMEOUT_ERR)
+        kind = MC1081_RETRY_ON_TIMEOUT;
+
+    if (attempt >= p->retries || !(p->retry_on & kind))
+        return false;
+
+    // 退避时间逐次加倍, 先封顶再防止移位溢出
+    uint64_t us = (attempt < 32) ? ((uint64_t)p->backoff_us << attempt) : 0xFFFFFFFFULL;
+    if (p->backoff_max_us != 0 && us > p->backoff_max_us)
+        us = p->backoff_max_us;
+    if (handle->bus.Delay == NULL)
+        us = 0;
+
+    // 退避结束时已过截止时间则放弃, 返回最后一次的错误
+    if (handle->op_deadline_ns != 0 && ClockNow(handle) + us * 1000ULL >= handle->op_deadline_ns)
+    {
+        MC1081_STAT_ADD(handle, deadlines, 1);
+        return false;
+    }
+
+    if (us != 0)
+        handle->bus.Delay(handle->bus.ctx, (uint32_t)us);
+
+    MC1081_STAT_ADD(handle, retries, 1);
+    return true;
+}
+
+/**
+ * @brief 单次写传输, 不重试
+ */
+static MC1081_Status_t WriteOnce(MC1081_Handle_t handle, const uint8_t *data, const size_t len)
+{
+    MC1081_STAT_ADD(handle, tx, 1);
+    MC1081_STAT_ADD(handle, wr_bytes, len);
+
+    if (handle->bus.Deadline != NULL)
+        handle->bus.Deadline(handle->bus.ctx, handle->op_deadline_ns); // 0 清除上一次操作的截止时间
+
+    const MC1081_Status_t sta = BusStatus(handle->bus.Write(handle->bus.ctx, handle->I2c_addr, data, len), MC1081_WR_ERR);
+    if (sta != MC1081_OK)
+    {
+        MC1081_STAT_ADD(handle, wr_err, 1);
+        MC1081_STAT_ERR(handle, sta);
+    }
+
+    return sta;
+}
+
+/**
+ * @brief 单次读传输, 不重试
+ */
+static MC1081_Status_t ReadOnce(MC1081_Handle_t handle, uint8_t *data, size_t len)
+{
+    MC1081_STAT_ADD(handle, tx, 1);
+    MC1081_STAT_ADD(handle, rd_bytes, len);
+
+    if (handle->bus.Deadline != NULL)
+        handle->bus.Deadline(handle->bus.ctx, handle->op_deadline_ns); // 0 清除上一次操作的截止时间
+
+    const MC1081_Status_t sta = BusStatus(handle->bus.Read(handle->bus.ctx, handle->I2c_addr, data, len), MC1081_RR_ERR);
+    if (sta != MC1081_OK)
+    {
+        MC1081_STAT_ADD(handle, rd_err, 1);
+        MC1081_STAT_ERR(handle, sta);
+    }
+
+    return sta;
+}
+
+/**
+ * @brief 写传输, 开始一次寄存器操作; 单字节写为读操作的指针阶段, 截止时间与计时延续到 ReadByte
+ */
 static inline MC1081_Status_t WriteByte(MC1081_Handle_t handle, const uint8_t *data, const size_t len)
 {
     MC1081_CHECKPTR(handle);
     MC1081_CHECKPTR(data);
 
-    if(handle->conf.Transmit(data,len) != 0)
+    MC1081_Status_t sta = OpBegin(handle);
+    MC1081_CHECKERR(sta);
+
+    handle->reg_ptr = data[0];
+
+    sta = WriteOnce(handle, data, len);
+    for (uint8_t attempt = 0; sta != MC1081_OK; attempt++)
     {
-      return MC1081_WR_ERR;
+        if (!RetryWait(handle, sta, attempt))
+            return sta;
+        sta = WriteOnce(handle, data, len);
     }
+
+    if (len > 1)
+        MC1081_STAT_TIME(handle, MC1081_OP_WRITE, handle->stats_t0, ClockNow(handle));
+
     return MC1081_OK;
 }
 
 static inline MC1081_Status_t ReadByte(MC1081_Handle_t handle, uint8_t *data, size_t len)
 {
-    if(handle->conf.Receive(data,len) != 0)
+    MC1081_Status_t sta = ReadOnce(handle, data, len);
+
+    for (uint8_t attempt = 0; sta != MC1081_OK; attempt++)
+    {
+        if (!RetryWait(handle, sta, attempt))
+            return sta;
+
+        // 读阶段失败后芯片的寄存器指针可能已经递增, 连同指针一起重做
+        sta = WriteOnce(handle, &handle->reg_ptr, 1);
+        if (sta == MC1081_OK)
+            sta = ReadOnce(handle, data, len);
+    }
+
+    MC1081_STAT_TIME(handle, MC1081_OP_READ, handle->stats_t0, ClockNow(handle));
+
+    return MC1081_OK;
+}
+
+/**
+ * @brief 单次组合读传输: 每段写寄存器指针, 重复起始后读数据, 不重试
+ */
+static MC1081_Status_t ReadRegsOnce(MC1081_Handle_t handle, const MC1081_ScanBurst_t *burst, uint8_t num, uint8_t *dst, size_t total)
+{
+    MC1081_STAT_ADD(handle, tx, 1);
+    MC1081_STAT_ADD(handle, wr_bytes, num);
+    MC1081_STAT_ADD(handle, rd_bytes, total);
+    (void)total; // 关闭统计时未使用
+
+    if (handle->bus.Deadline != NULL)
+        handle->bus.Deadline(handle->bus.ctx, handle->op_deadline_ns);
+
+    const MC1081_Status_t sta = BusStatus(handle->bus.ReadRegs(handle->bus.ctx, handle->I2c_addr, burst, num, dst), MC1081_RR_ERR);
+    if (sta != MC1081_OK)
+    {
+        MC1081_STAT_ADD(handle, rd_err, 1);
+        MC1081_STAT_ERR(handle, sta);
+    }
+
+    return sta;
+}
+
+/**
+ * @brief 读若干段寄存器, 数据首尾相接写入 dst; 总线支持组合读时一次完成, 否则每段写指针 + 读
+ */
+static MC1081_Status_t ReadBursts(MC1081_Handle_t handle, const MC1081_ScanBurst_t *burst, uint8_t num, uint8_t *dst)
+{
+    MC1081_Status_t sta = MC1081_OK;
+
+    if (handle->bus.ReadRegs == NULL)
+    {
+        for (uint8_t i = 0; i < num; i++)
+        {
+            sta = WriteByte(handle, &burst[i].reg, 1);
+            MC1081_CHECKERR(sta);
+
+            sta = ReadByte(handle, dst, burst[i].len);
+            MC1081_CHECKERR(sta);
+
+            dst += burst[i].len;
+        }
+        return sta;
+    }
+
+    size_t total = 0;
+    for (uint8_t i = 0; i < num; i++)
+        total += burst[i].len;
+
+    sta = OpBegin(handle);
+    MC1081_CHECKERR(sta);
+
+    // 指针写包含在每次传输内, 重试时整体重做
+    sta = ReadRegsOnce(handle, burst, num, dst, total);
+    for (uint8_t attempt = 0; sta != MC1081_OK; attempt++)
+    {
+        if (!RetryWait(handle, sta, attempt))
+            return sta;
+        sta = ReadRegsOnce(handle, burst, num, dst, total);
+    }
+
+    MC1081_STAT_TIME(handle, MC1081_OP_READ, handle->stats_t0, ClockNow(handle));
+
+    return MC1081_OK;
+}
+
+/**
+ * @brief 从 reg 起连续读 len 个寄存器
+ */
+static MC1081_Status_t ReadRegs(MC1081_Handle_t handle, uint8_t reg, uint8_t *data, size_t len)
+{
+    const MC1081_ScanBurst_t burst = {reg, (uint8_t)len};
+
+    return ReadBursts(handle, &burst, 1, data);
+}
+
+#define MC1081_SHADOW_IDX(reg) ((uint8_t)((reg) - MC1081_REG_T_CMD))
+#define MC1081_SHADOW_MASK(reg, len) ((uint16_t)(((1U << (len)) - 1U) << MC1081_SHADOW_IDX(reg)))
+
+/**
+ * @brief 写配置寄存器并同步影子寄存器, data[0] 为起始寄存器地址
+ */
+static MC1081_Status_t WriteConfig(MC1081_Handle_t handle, const uint8_t *data, const size_t len)
+{
+    MC1081_Status_t sta = WriteByte(handle, data, len);
+    MC1081_CHECKERR(sta);
+
+    memcpy(&handle->shadow[MC1081_SHADOW_IDX(data[0])], &data[1], len - 1);
+    handle->shadow_valid |= MC1081_SHADOW_MASK(data[0], len - 1);
+
+    return sta;
+}
+
+/**
+ * @brief 读配置寄存器, 影子寄存器有效时不访问总线
+ */
+static MC1081_Status_t ReadConfig(MC1081_Handle_t handle, uint8_t reg, uint8_t *data, const size_t len)
+{
+    const uint16_t mask = MC1081_SHADOW_MASK(reg, len);
+    uint8_t *shadow = &handle->shadow[MC1081_SHADOW_IDX(reg)];
+
+    if ((handle->shadow_valid & mask) != mask)
     {
-      return MC1081_RR_ERR;
+        MC1081_Status_t sta = ReadRegs(handle, reg, shadow, len);
+        MC1081_CHECKERR(sta);
+
+        handle->shadow_valid |= mask;
     }
+
+    memcpy(data, shadow, len);
     return MC1081_OK;
 }
 
+/**
+ * @brief 处理读到的 STATUS; 单次转换结束后芯片把 OS 清回停止, 影子寄存器随之更新
+ */
+static void StatusSeen(MC1081_Handle_t handle, uint8_t cap, uint8_t temp)
+{
+    const uint16_t mask = MC1081_SHADOW_MASK(MC1081_REG_C_CMD, 1);
+
+    if (!cap && (handle->shadow_valid & mask))
+    {
+        MC1081_C_CMD_t c_cmd = {0};
+        c_cmd.byte = handle->shadow[MC1081_SHADOW_IDX(MC1081_REG_C_CMD)];
+        if (c_cmd.bits.OS == MC1081_CAP_START_SINGLE)
+        {
+            c_cmd.bits.OS = MC1081_CAP_START_STOP;
+            handle->shadow[MC1081_SHADOW_IDX(MC1081_REG_C_CMD)] = c_cmd.byte;
+        }
+    }
+
+    (void)temp;
+    MC1081_STAT_STATUS(handle, cap, temp);
+}
+
+#if !MC1081_USE_HEAP
+#if MC1081_HANDLE_POOL_SIZE < 1 || MC1081_HANDLE_POOL_SIZE > 255
+#error "MC1081_HANDLE_POOL_SIZE must be in 1 ~ 255"
+#endif
+
+static MC1081_Obj_t s_pool[MC1081_HANDLE_POOL_SIZE];
+static uint8_t s_pool_taken[MC1081_HANDLE_POOL_SIZE]; // 1: 对象已被占用, 以 CAS 抢占
+#endif
+
+/**
+ * @brief 分配句柄对象; 对象池以 CAS 逐个抢占空位, 可在多个线程中同时调用
+ */
+static MC1081_Obj_t *ObjAlloc(void)
+{
+#if MC1081_USE_HEAP
+    MC1081_Obj_t *obj = (MC1081_Obj_t *)calloc(1, sizeof(MC1081_Obj_t));
+    if (obj != NULL)
+        obj->origin = MC1081_OBJ_HEAP;
+#else
+    MC1081_Obj_t *obj = NULL;
+    for (uint16_t i = 0; i < MC1081_HANDLE_POOL_SIZE && obj == NULL; i++)
+    {
+        uint8_t expected = 0;
+        if (__atomic_compare_exchange_n(&s_pool_taken[i], &expected, 1, false, __ATOMIC_ACQUIRE, __ATOMIC_RELAXED))
+            obj = &s_pool[i];
+    }
+
+    if (obj != NULL)
+    {
+        memset(obj, 0, sizeof(MC1081_Obj_t));
+        obj->origin = MC1081_OBJ_POOL;
+    }
+#endif
+    return obj;
+}
+
+/**
+ * @brief 释放句柄对象, O(1); 释放后标记为 FREE, 失效的句柄不会被当作有效对象
+ */
+static void ObjFree(MC1081_Obj_t *obj)
+{
+    switch (obj->origin)
+    {
+#if MC1081_USE_HEAP
+    case MC1081_OBJ_HEAP:
+        free(obj);
+        break;
+#else
+    case MC1081_OBJ_POOL:
+        obj->origin = MC1081_OBJ_FREE;
+        __atomic_store_n(&s_pool_taken[obj - s_pool], 0, __ATOMIC_RELEASE);
+        break;
+#endif
+    default:
+        memset(obj, 0, sizeof(MC1081_Obj_t));
+        obj->origin = MC1081_OBJ_FREE;
+        break;
+    }
+}
+
+/**
+ * @brief 旧版回调适配: 忽略地址, 转发到 MC1081_Conf_t 中的 Transmit
+ */
+static int LegacyWrite(void *ctx, uint8_t addr, const uint8_t *data, size_t len)
+{
+    (void)addr;
+    return ((MC1081_Conf_t *)ctx)->Transmit(data, len);
+}
+
+/**
+ * @brief 旧版回调适配: 忽略地址, 转发到 MC1081_Conf_t 中的 Receive
+ */
+static int LegacyRead(void *ctx, uint8_t addr, uint8_t *dst, size_t len)
+{
+    (void)addr;
+    return ((MC1081_Conf_t *)ctx)->Receive(dst, len);
+}
+
+/**
+ * @brief 旧版回调适配: 转发到 MC1081_Conf_t 中的 Delay
+ */
+static void LegacyDelay(void *ctx, uint32_t us)
+{
+    ((MC1081_Conf_t *)ctx)->Delay(us);
+}
+
 MC1081_Status_t MC1081_Init(MC1081_Handle_t *handle, MC1081_Conf_t *conf)
 {
     if (handle == NULL || conf == NULL || (*handle) != NULL)
@@ -46,11 +522,51 @@ MC1081_Status_t MC1081_Init(MC1081_Handle_t *handle, MC1081_Conf_t *conf)
 
     if(conf->Receive == NULL || conf->Transmit == NULL) return MC1081_ERR;
 
-    (*handle) = (MC1081_Obj_t *)calloc(1, sizeof(MC1081_Obj_t));
+    (*handle) = ObjAlloc();
 
     if ((*handle) == NULL)
         return MC1081_MEM_ERR;
+    (*handle)->conf = *conf;
+    (*handle)->bus.ctx = &(*handle)->conf;
+    (*handle)->bus.Write = LegacyWrite;
+    (*handle)->bus.Read = LegacyRead;
+    (*handle)->bus.Delay = (conf->Delay != NULL) ? LegacyDelay : NULL;
     (*handle)->I2c_addr = MC1081_DEFAULT_I2CADDR;
+    (*handle)->fref_hz = MC1081_FREF_HZ;
+
+    return MC1081_OK;
+}
+
+MC1081_Status_t MC1081_InitBus(MC1081_Handle_t *handle, const MC1081_Bus_t *bus, uint8_t addr)
+{
+    if (handle == NULL || bus == NULL || (*handle) != NULL)
+        return MC1081_PARAM_ERR;
+
+    if(bus->Read == NULL || bus->Write == NULL) return MC1081_ERR;
+
+    (*handle) = ObjAlloc();
+
+    if ((*handle) == NULL)
+        return MC1081_MEM_ERR;
+    (*handle)->bus = *bus;
+    (*handle)->I2c_addr = addr;
+    (*handle)->fref_hz = MC1081_FREF_HZ;
+
+    return MC1081_OK;
+}
+
+MC1081_Status_t MC1081_InitStatic(MC1081_Obj_t *storage, const MC1081_Bus_t *bus, uint8_t addr)
+{
+    MC1081_CHECKPTR(storage);
+    MC1081_CHECKPTR(bus);
+
+    if(bus->Read == NULL || bus->Write == NULL) return MC1081_ERR;
+
+    memset(storage, 0, sizeof(MC1081_Obj_t));
+    storage->origin = MC1081_OBJ_STATIC;
+    storage->bus = *bus;
+    storage->I2c_addr = addr;
+    storage->fref_hz = MC1081_FREF_HZ;
 
     return MC1081_OK;
 }
@@ -65,9 +581,7 @@ MC1081_Status_t MC1081_GetTempRaw(MC1081_Handle_t handle, uint16_t *raw)
 
     MC1081_TDATA_Reg_t tdata = {0};
 
-    ret = WriteByte(handle, &msb_reg, 1); // 写一个字节
-    MC1081_CHECKERR(ret);
-    ret = ReadByte(handle, (uint8_t *)&tdata.bytes, 2); // 连续读取2个字节
+    ret = ReadRegs(handle, msb_reg, (uint8_t *)&tdata.bytes, 2); // 连续读取2个字节
     MC1081_CHECKERR(ret);
 
     *raw = tdata.bytes;
@@ -82,11 +596,8 @@ MC1081_Status_t MC1081_GetMCHxRaw(MC1081_Handle_t handle, MC1081_Channel_MCH_t c
     MC1081_CHECKPTR(raw);
 
     uint8_t reg = (4 * (uint8_t)ch) + 4;
-    MC1081_Status_t sta = WriteByte(handle, &reg, 1);
-    MC1081_CHECKERR(sta);
-
     uint8_t buf[2] = {0};
-    sta = ReadByte(handle, buf, 2);
+    MC1081_Status_t sta = ReadRegs(handle, reg, buf, 2);
     MC1081_CHECKERR(sta);
 
     MC1081_CHDATA_t data = {0};
@@ -103,11 +614,8 @@ MC1081_Status_t MC1081_GetSigleCHxRaw(MC1081_Handle_t handle, MC1081_Channel_Sin
     MC1081_CHECKPTR(raw);
 
     uint8_t reg = (2 * (uint8_t)ch) + 2;
-    MC1081_Status_t sta = WriteByte(handle, &reg, 1);
-    MC1081_CHECKERR(sta);
-
     uint8_t buf[2] = {0};
-    sta = ReadByte(handle, buf, 2);
+    MC1081_Status_t sta = ReadRegs(handle, reg, buf, 2);
     MC1081_CHECKERR(sta);
 
     MC1081_CHDATA_t data = {0};
@@ -132,11 +640,8 @@ MC1081_Status_t MC1081_GetDiffDCHxRaw(MC1081_Handle_t handle, MC1081_Channel_Dif
     reg = (2 * (uint8_t)ch) + 2;
 
 
-    MC1081_Status_t sta = WriteByte(handle, &reg, 1);
-    MC1081_CHECKERR(sta);
-
     uint8_t buf[2] = {0};
-    sta = ReadByte(handle, buf, 2);
+    MC1081_Status_t sta = ReadRegs(handle, reg, buf, 2);
     MC1081_CHECKERR(sta);
 
     MC1081_CHDATA_t data = {0};
@@ -147,31 +652,361 @@ MC1081_Status_t MC1081_GetDiffDCHxRaw(MC1081_Handle_t handle, MC1081_Channel_Dif
     return sta;
 }
 
-bool MC1081_IsSingleChOverflow(MC1081_Handle_t handle, MC1081_Channel_Single_t ch)
+/**
+ * @brief 解码以寄存器地址为下标的结果块 0x00 ~ 0x1B
+ */
+static void DecodeResultBlock(const uint8_t *buf, MC1081_Snapshot_t *snap)
 {
-    MC1081_CHECKPTR(handle);
+    MC1081_TDATA_Reg_t tdata = {0};
+    tdata.bits.T_LSB = buf[MC1081_REG_TDATA];
+    tdata.bits.T_MSB = buf[MC1081_REG_TDATA + 1];
+    snap->temp = tdata.bytes;
 
-    const uint8_t reg_addr = 0x18;
-    MC1081_OSC1_t osc_status = {0};
+    MC1081_CHDATA_t data = {0};
+    for (uint8_t i = 0; i < MC1081_CH_NUM; i++)
+    {
+        data.bits.D_MSB = buf[(2 * i) + 2];
+        data.bits.D_LSB = buf[(2 * i) + 3];
+        snap->ch[i] = data.bytes;
+    }
 
-    if (WriteByte(handle, &reg_addr, 1) != MC1081_OK)
-        return false;
-    if (ReadByte(handle, (uint8_t *)&osc_status.bytes, 2) != MC1081_OK)
-        return false;
+    for (uint8_t i = 0; i < MC1081_MCH_NUM; i++)
+    {
+        data.bits.D_MSB = buf[(4 * i) + 4];
+        data.bits.D_LSB = buf[(4 * i) + 5];
+        snap->mch[i] = data.bytes;
+    }
 
-    return (osc_status.bytes & (1U << (uint8_t)ch)) != 0;
-}
+    snap->of_single = (uint16_t)(buf[MC1081_REG_OSC1] | (buf[MC1081_REG_OSC1 + 1] << 8));
+    snap->of_diff = buf[MC1081_REG_OSC2];
 
+    MC1081_STATUSReg_t status = {0};
+    status.byte = buf[MC1081_REG_STATUS];
+    snap->isCapConverting = status.bits.FLAG_CCVT;
+    snap->isTempConverting = status.bits.FLAG_TCVT;
+}
 
-bool MC1081_CheckchxOverflow_Diff(MC1081_Handle_t handle, MC1081_Channel_Diff_t ch)
+/**
+ * @brief 记录一次读取的时间
+ *
+ * 持续转换时, 读到的数据完成于请求之前一个帧周期内的任意时刻, 取其中点作为估计.
+ */
+static void StampRead(MC1081_Handle_t handle, uint64_t request_ns, uint64_t bus_ns)
 {
-    MC1081_CHECKPTR(handle);
-    const uint8_t reg_addr = 0x1A;
-    MC1081_OSC2_t osc_status = {0};
+    if (handle->clock == NULL)
+        return;
 
-    if (WriteByte(handle, &reg_addr, 1) != MC1081_OK)
+    const uint64_t age_ns = handle->period_ns / 2U;
+
+    handle->time.request_ns = request_ns;
+    handle->time.bus_ns = bus_ns;
+    handle->time.conv_ns = (request_ns > age_ns) ? (request_ns - age_ns) : 0;
+
+    MC1081_STAT_TIME(handle, MC1081_OP_FRAME, request_ns, bus_ns);
+}
+
+/**
+ * @brief 按挂接顺序执行处理阶段, 任一阶段丢弃则停止
+ */
+static MC1081_Status_t RunStages(MC1081_Handle_t handle, MC1081_Snapshot_t *snap)
+{
+    MC1081_STAT_FRAME(handle, snap);
+
+    for (MC1081_Stage_t *s = handle->stages; s != NULL; s = s->next)
+    {
+        if (!s->fn(s->ctx, snap))
+        {
+            MC1081_STAT_ADD(handle, drops, 1);
+            return MC1081_DROP_ERR;
+        }
+    }
+
+    return MC1081_OK;
+}
+
+/**
+ * @brief 读取并解码结果块, 不经过处理阶段
+ */
+static MC1081_Status_t ReadResultBlock(MC1081_Handle_t handle, MC1081_Snapshot_t *snap)
+{
+    const uint8_t reg_addr = MC1081_REG_TDATA;
+    uint8_t buf[MC1081_RESULT_REG_NUM] = {0};
+
+    MC1081_Status_t sta = ReadRegs(handle, reg_addr, buf, sizeof(buf)); // 自动递增，一次读完 0x00 ~ 0x1B
+    MC1081_CHECKERR(sta);
+
+    DecodeResultBlock(buf, snap);
+    StatusSeen(handle, snap->isCapConverting, snap->isTempConverting);
+
+    return sta;
+}
+
+MC1081_Status_t MC1081_ReadSnapshot(MC1081_Handle_t handle, MC1081_Snapshot_t *snap)
+{
+    MC1081_CHECKPTR(handle);
+    MC1081_CHECKPTR(snap);
+
+    const uint64_t request_ns = ClockNow(handle);
+
+    MC1081_Status_t sta = ReadResultBlock(handle, snap);
+    MC1081_CHECKERR(sta);
+
+    StampRead(handle, request_ns, ClockNow(handle));
+
+    return RunStages(handle, snap);
+}
+
+#define MC1081_SCAN_WORD(reg) (3UL << (reg))
+
+/**
+ * @brief 一次 "写寄存器地址 + 读 n 字节" 的 SCL 时钟数为 31 + 9n;
+ *        组合读中每段为 "地址 + 指针, 重复起始, 地址 + n 字节" 共 28 + 9n, 整个列表另加 START/STOP
+ */
+#define MC1081_SCAN_TX_CLK (31U)
+#define MC1081_SCAN_RS_CLK (28U)
+#define MC1081_SCAN_START_CLK (2U)
+#define MC1081_SCAN_BYTE_CLK (9U)
+
+MC1081_Status_t MC1081_ScanPlanMake(MC1081_ScanPlan_t *plan, const MC1081_DeviceConfig_t *cfg, uint8_t flags,
+                                    uint32_t scl_hz, uint32_t overhead_ns)
+{
+    MC1081_CHECKPTR(plan);
+    MC1081_CHECKPTR(cfg);
+    if (scl_hz == 0)
+        return MC1081_PARAM_ERR;
+
+    uint32_t need = 0;
+
+    if (flags & MC1081_SCAN_TEMP)
+        need |= MC1081_SCAN_WORD(MC1081_REG_TDATA);
+
+    if (cfg->cap.osc_mode == MC1081_CAP_OSC_DIFF)
+    {
+        for (uint8_t k = 0; k <= MC1081_DCH_DIFF_REF; k++)
+        {
+            if (cfg->ch_diff.value & (1U << k))
+                need |= MC1081_SCAN_WORD(MC1081_REG_CHDATA + (2 * k));
+        }
+    }
+    else
+    {
+        for (uint8_t i = 0; i < MC1081_CH_NUM; i++)
+        {
+            if (cfg->ch_single.value & (1U << i))
+                need |= MC1081_SCAN_WORD(MC1081_REG_CHDATA + (2 * i));
+        }
+
+        for (uint8_t k = 0; k < MC1081_MCH_NUM; k++)
+        {
+            if (cfg->mch.value & (1U << k))
+                need |= MC1081_SCAN_WORD((4 * k) + 4);
+        }
+    }
+
+    if (flags & MC1081_SCAN_FLAGS)
+        need |= 0xFUL << MC1081_REG_OSC1; // 0x18 ~ 0x1B
+
+    if (need == 0)
+        return MC1081_PARAM_ERR;
+
+    // 间隔 g 字节的两段: 合并多读 9g 个时钟, 分开多一段的固定开销;
+    // 组合读时整个计划只有一次传输, 主机开销不随段数增加
+    const bool combined = (flags & MC1081_SCAN_COMBINED) != 0;
+    const uint64_t split_clk = combined ? MC1081_SCAN_RS_CLK
+                                        : MC1081_SCAN_TX_CLK + ((uint64_t)overhead_ns * scl_hz) / 1000000000ULL;
+
+    MC1081_ScanBurst_t run[MC1081_RESULT_REG_NUM];
+    uint8_t num = 0;
+
+    uint8_t reg = 0;
+    while (reg < MC1081_RESULT_REG_NUM)
+    {
+        if (!(need & (1UL << reg)))
+        {
+            reg++;
+            continue;
+        }
+
+        uint8_t end = reg; // 当前段最后一个所需寄存器
+        for (uint8_t j = (uint8_t)(reg + 1); j < MC1081_RESULT_REG_NUM; j++)
+        {
+            if (!(need & (1UL << j)))
+                continue;
+            if ((uint64_t)(j - end - 1) * MC1081_SCAN_BYTE_CLK > split_clk)
+                break;
+            end = j;
+        }
+
+        run[num].reg = reg;
+        run[num].len = (uint8_t)(end - reg + 1);
+        num++;
+
+        reg = (uint8_t)(end + 1);
+    }
+
+    // 段数超出计划容量时, 反复合并间隔最小 (多读最少) 的相邻两段
+    while (num > MC1081_SCAN_MAX_BURSTS)
+    {
+        uint8_t best = 0;
+        uint8_t best_gap = 0xFF;
+        for (uint8_t i = 0; i + 1 < num; i++)
+        {
+            const uint8_t gap = (uint8_t)(run[i + 1].reg - (run[i].reg + run[i].len));
+            if (gap < best_gap)
+            {
+                best_gap = gap;
+                best = i;
+            }
+        }
+
+        run[best].len = (uint8_t)(run[best + 1].reg + run[best + 1].len - run[best].reg);
+        memmove(&run[best + 1], &run[best + 2], (size_t)(num - best - 2) * sizeof(MC1081_ScanBurst_t));
+        num--;
+    }
+
+    memset(plan, 0, sizeof(MC1081_ScanPlan_t));
+    plan->need = need;
+    plan->num = num;
+    for (uint8_t i = 0; i < num; i++)
+    {
+        plan->burst[i] = run[i];
+        plan->bytes = (uint8_t)(plan->bytes + run[i].len);
+    }
+
+    uint64_t clk = 0;
+    uint64_t host_ns = 0;
+    if (combined)
+    {
+        clk = MC1081_SCAN_START_CLK + (uint64_t)num * MC1081_SCAN_RS_CLK;
+        host_ns = overhead_ns;
+    }
+    else
+    {
+        clk = (uint64_t)num * MC1081_SCAN_TX_CLK;
+        host_ns = (uint64_t)num * overhead_ns;
+    }
+    clk += (uint64_t)plan->bytes * MC1081_SCAN_BYTE_CLK;
+    plan->cost_ns = (uint32_t)((clk * 1000000000ULL) / scl_hz + host_ns);
+
+    return MC1081_OK;
+}
+
+/**
+ * @brief 按扫描计划读取并解码, 计划外的字为 0, 不经过处理阶段
+ */
+static MC1081_Status_t ReadPlanned(MC1081_Handle_t handle, const MC1081_ScanPlan_t *plan, MC1081_Snapshot_t *snap)
+{
+    uint8_t buf[MC1081_RESULT_REG_NUM] = {0};
+    MC1081_Status_t sta = MC1081_OK;
+
+    const uint8_t num = (plan->num < MC1081_SCAN_MAX_BURSTS) ? plan->num : MC1081_SCAN_MAX_BURSTS;
+    uint16_t total = 0;
+
+    for (uint8_t i = 0; i < num; i++)
+    {
+        const MC1081_ScanBurst_t *b = &plan->burst[i];
+        if ((uint16_t)b->reg + b->len > MC1081_RESULT_REG_NUM)
+            return MC1081_PARAM_ERR;
+        total = (uint16_t)(total + b->len);
+    }
+    if (total > MC1081_RESULT_REG_NUM)
+        return MC1081_PARAM_ERR;
+
+    // 全部突发读一次交给总线, 数据首尾相接, 再按寄存器地址放回
+    uint8_t packed[MC1081_RESULT_REG_NUM] = {0};
+    sta = ReadBursts(handle, plan->burst, num, packed);
+    MC1081_CHECKERR(sta);
+
+    for (uint8_t i = 0, off = 0; i < num; i++)
+    {
+        memcpy(&buf[plan->burst[i].reg], &packed[off], plan->burst[i].len);
+        off = (uint8_t)(off + plan->burst[i].len);
+    }
+
+    DecodeResultBlock(buf, snap);
+    if (plan->need & (1UL << MC1081_REG_STATUS))
+        StatusSeen(handle, snap->isCapConverting, snap->isTempConverting);
+
+    return sta;
+}
+
+MC1081_Status_t MC1081_ScanRead(MC1081_Handle_t handle, const MC1081_ScanPlan_t *plan, MC1081_Snapshot_t *snap)
+{
+    MC1081_CHECKPTR(handle);
+    MC1081_CHECKPTR(plan);
+    MC1081_CHECKPTR(snap);
+
+    const uint64_t request_ns = ClockNow(handle);
+
+    MC1081_Status_t sta = ReadPlanned(handle, plan, snap);
+    MC1081_CHECKERR(sta);
+
+    StampRead(handle, request_ns, ClockNow(handle));
+
+    return RunStages(handle, snap);
+}
+
+MC1081_Status_t MC1081_StageAttach(MC1081_Handle_t handle, MC1081_Stage_t *stage, MC1081_StageFunc_t fn, void *ctx)
+{
+    MC1081_CHECKPTR(handle);
+    MC1081_CHECKPTR(stage);
+    MC1081_CHECKPTR(fn);
+
+    MC1081_Stage_t **link = &handle->stages;
+    while (*link != NULL)
+    {
+        if (*link == stage)
+            return MC1081_PARAM_ERR; // 已挂接
+        link = &(*link)->next;
+    }
+
+    stage->fn = fn;
+    stage->ctx = ctx;
+    stage->next = NULL;
+    *link = stage;
+
+    return MC1081_OK;
+}
+
+MC1081_Status_t MC1081_StageDetach(MC1081_Handle_t handle, MC1081_Stage_t *stage)
+{
+    MC1081_CHECKPTR(handle);
+    MC1081_CHECKPTR(stage);
+
+    for (MC1081_Stage_t **link = &handle->stages; *link != NULL; link = &(*link)->next)
+    {
+        if (*link == stage)
+        {
+            *link = stage->next;
+            stage->next = NULL;
+            return MC1081_OK;
+        }
+    }
+
+    return MC1081_PARAM_ERR;
+}
+
+bool MC1081_IsSingleChOverflow(MC1081_Handle_t handle, MC1081_Channel_Single_t ch)
+{
+    MC1081_CHECKPTR(handle);
+
+    const uint8_t reg_addr = 0x18;
+    MC1081_OSC1_t osc_status = {0};
+
+    if (ReadRegs(handle, reg_addr, (uint8_t *)&osc_status.bytes, 2) != MC1081_OK)
         return false;
-    if (ReadByte(handle, (uint8_t *)&osc_status.byte, 2) != MC1081_OK)
+
+    return (osc_status.bytes & (1U << (uint8_t)ch)) != 0;
+}
+
+
+bool MC1081_CheckchxOverflow_Diff(MC1081_Handle_t handle, MC1081_Channel_Diff_t ch)
+{
+    MC1081_CHECKPTR(handle);
+    const uint8_t reg_addr = 0x1A;
+    MC1081_OSC2_t osc_status = {0};
+
+    if (ReadRegs(handle, reg_addr, &osc_status.byte, 1) != MC1081_OK)
         return false;
 
     return (osc_status.byte & (1U << (uint8_t)ch)) != 0;
@@ -183,9 +1018,7 @@ bool MC1081_IsMChOverflow(MC1081_Handle_t handle, MC1081_Channel_MCH_t ch)
     const uint8_t reg_addr = 0x18;
     MC1081_OSC1_t osc_status = {0};
 
-    if (WriteByte(handle, &reg_addr, 1) != MC1081_OK)
-        return false;
-    if (ReadByte(handle, (uint8_t *)&osc_status.bytes, 2) != MC1081_OK)
+    if (ReadRegs(handle, reg_addr, (uint8_t *)&osc_status.bytes, 2) != MC1081_OK)
         return false;
 
     return (osc_status.bits.MOF & (1U << (uint8_t)ch)) != 0;
@@ -195,20 +1028,13 @@ MC1081_Status_t MC1081_ClearOverflowFlag(MC1081_Handle_t handle)
 {
     MC1081_CHECKPTR(handle);
 
-    const uint8_t reg_addr = 0x1b;
-
-    MC1081_Status_t sta = WriteByte(handle, &reg_addr, 1);
-    MC1081_CHECKERR(sta);
-
+    // 其余位只读, 一次写入 {地址, OF_CLEAR} 即可
     MC1081_STATUSReg_t status = {0};
-    sta = ReadByte(handle, &status.byte, 1);
-    MC1081_CHECKERR(sta);
-
     status.bits.OF_CLEAR = 1;
-    sta = WriteByte(handle, &status.byte, 1);
-    MC1081_CHECKERR(sta);
 
-    return sta;
+    const uint8_t data[2] = {MC1081_REG_STATUS, status.byte};
+
+    return WriteByte(handle, data, 2);
 }
 
 MC1081_Status_t MC1081_GetStatus(MC1081_Handle_t handle, uint8_t *isCapConverting, uint8_t *isTempConverting)
@@ -219,15 +1045,13 @@ MC1081_Status_t MC1081_GetStatus(MC1081_Handle_t handle, uint8_t *isCapConvertin
 
     const uint8_t reg_addr = 0x1b;
 
-    MC1081_Status_t sta = WriteByte(handle, &reg_addr, 1);
-    MC1081_CHECKERR(sta);
-
     MC1081_STATUSReg_t status = {0};
-    sta = ReadByte(handle, &status.byte, 1);
+    MC1081_Status_t sta = ReadRegs(handle, reg_addr, &status.byte, 1);
     MC1081_CHECKERR(sta);
 
     *isCapConverting = status.bits.FLAG_CCVT;
     *isTempConverting = status.bits.FLAG_TCVT;
+    StatusSeen(handle, status.bits.FLAG_CCVT, status.bits.FLAG_TCVT);
 
     return sta;
 }
@@ -246,7 +1070,7 @@ MC1081_Status_t MC1081_TempConfig(MC1081_Handle_t handle, MC1081_TempConvState_t
     buf[0] = reg_addr;
     buf[1] = t_cmd.byte;
 
-    return WriteByte(handle, buf, 2);
+    return WriteConfig(handle, buf, 2);
 }
 
 MC1081_Status_t MC1081_CapMeasureSet(MC1081_Handle_t handle, MC1081_CapConvConfig_t conf)
@@ -266,339 +1090,1182 @@ MC1081_Status_t MC1081_CapMeasureSet(MC1081_Handle_t handle, MC1081_CapConvConfi
     buf[0] = reg_addr;
     buf[1] = c_cmd.byte;
 
-    return WriteByte(handle, buf, 2);
+    return WriteConfig(handle, buf, 2);
+}
+
+MC1081_Status_t MC1081_CapMeasureGet(MC1081_Handle_t handle, MC1081_CapConvConfig_t *conf)
+{
+    MC1081_CHECKPTR(handle);
+    MC1081_CHECKPTR(conf);
+
+    MC1081_C_CMD_t c_cmd = {0};
+    MC1081_Status_t sta = ReadConfig(handle, MC1081_REG_C_CMD, &c_cmd.byte, 1);
+    MC1081_CHECKERR(sta);
+
+    conf->avg_cycle = c_cmd.bits.CAVG;
+    conf->interval = c_cmd.bits.CR;
+    conf->osc_mode = c_cmd.bits.OSC_SEL;
+    conf->sleep = c_cmd.bits.SLEEP_EN;
+    conf->start = c_cmd.bits.OS;
+
+    return sta;
+}
+
+/**
+ * @brief 设定 fin 的测量周期个数 N
+ *
+ * @param handle
+ * @param cycle
+ * @return MC1081_Status_t
+ */
+MC1081_Status_t MC1081_SetFinCycle(MC1081_Handle_t handle, uint8_t cycle)
+{
+    MC1081_CHECKPTR(handle);
+
+    uint8_t data[2] = {0x1E, 0x00};
+    data[1] = cycle;
+
+    return WriteConfig(handle, data, 2);
+}
+
+MC1081_Status_t MC1081_GetFinCycle(MC1081_Handle_t handle, uint8_t *cycle)
+{
+    MC1081_CHECKPTR(handle);
+    MC1081_CHECKPTR(cycle);
+
+    uint8_t data = 0x00;
+
+    MC1081_Status_t sta = ReadConfig(handle, MC1081_REG_FIN_CNT, &data, 1);
+    MC1081_CHECKERR(sta);
+
+    *cycle = data;
+
+    return sta;
+}
+
+/**
+ * @brief 时钟配置
+ *
+ * @return MC1081_Status_t
+ */
+MC1081_Status_t MC1081_SetClockConfig(MC1081_Handle_t handle, MC1081_ClockCfg_t cfg)
+{
+    MC1081_CHECKPTR(handle);
+
+    MC1081_DIV_CFG_t div_cfg = {0};
+
+    div_cfg.bits.FINDIV = cfg.fin_div;
+    div_cfg.bits.SETTLING = cfg.fin_build;
+    div_cfg.bits.FREFDIV = cfg.fref_div;
+
+    uint8_t data[2] = {0x1F, 0x00};
+    data[1] = div_cfg.byte;
+    return WriteConfig(handle, data, 2);
+}
+
+MC1081_Status_t MC1081_GetClockConfig(MC1081_Handle_t handle, MC1081_ClockCfg_t *cfg)
+{
+    MC1081_CHECKPTR(handle);
+    MC1081_CHECKPTR(cfg);
+
+    MC1081_DIV_CFG_t div_cfg = {0};
+
+    MC1081_Status_t sta = ReadConfig(handle, MC1081_REG_DIV_CFG, &div_cfg.byte, 1);
+    MC1081_CHECKERR(sta);
+
+    cfg->fin_build = div_cfg.bits.SETTLING;
+    cfg->fin_div = div_cfg.bits.FINDIV;
+    cfg->fref_div = div_cfg.bits.FREFDIV;
+
+    return sta;
+}
+
+MC1081_Status_t MC1081_ChSingleEnableSet(MC1081_Handle_t handle, MC1081_ChSingleEn_t ChSingle)
+{
+    MC1081_CHECKPTR(handle);
+
+    MC1081_OSC1_CHS_t osc1_chs = {0};
+
+    osc1_chs.bytes = ChSingle.value;
+
+    uint8_t data[3] = {0x20, 0x00, 0x00};
+    data[1] = (uint8_t)(osc1_chs.bytes & 0x00FF);
+    data[2] = (uint8_t)((osc1_chs.bytes & 0xFF00) >> 8);
+
+    return WriteConfig(handle, data, 3);
+}
+
+MC1081_Status_t MC1081_ChSingleEnableGet(MC1081_Handle_t handle, MC1081_ChSingleEn_t *ChSingle)
+{
+    MC1081_CHECKPTR(handle);
+    MC1081_CHECKPTR(ChSingle);
+
+    MC1081_OSC1_CHS_t osc1_chs = {0};
+
+    uint8_t data[2] = {0};
+    MC1081_Status_t sta = ReadConfig(handle, MC1081_REG_OSC1_CHS, data, 2);
+    MC1081_CHECKERR(sta);
+
+    osc1_chs.bytes = (uint16_t)(data[0] | (data[1] << 8));
+
+    ChSingle->value = osc1_chs.bytes;
+
+    return sta;
+}
+
+MC1081_Status_t MC1081_MchxEnableSet(MC1081_Handle_t handle, MC1081_MchEn_t Mchx)
+{
+    MC1081_CHECKPTR(handle);
+
+    MC1081_OSC1_MCHS_t osc1_mchs = {0};
+
+    uint8_t reg_addr = 0x22;
+    osc1_mchs.byte = Mchx.value;
+
+    uint8_t data[2] = {0};
+    data[0] = reg_addr;
+    data[1] = osc1_mchs.byte;
+    return WriteConfig(handle, data, 2);
+}
+
+MC1081_Status_t MC1081_MchxEnableGet(MC1081_Handle_t handle, MC1081_MchEn_t *Mchx)
+{
+    MC1081_CHECKPTR(handle);
+    MC1081_CHECKPTR(Mchx);
+
+    MC1081_OSC1_MCHS_t osc1_mchs = {0};
+
+    MC1081_Status_t sta = ReadConfig(handle, MC1081_REG_OSC1_MCHS, &osc1_mchs.byte, 1);
+    MC1081_CHECKERR(sta);
+
+    Mchx->value = osc1_mchs.byte;
+    return sta;
+}
+
+MC1081_Status_t MC1081_SingleOSCSet(MC1081_Handle_t handle, MC1081_SingleOSCCfg_t cfg)
+{
+    MC1081_CHECKPTR(handle);
+
+    MC1081_OSC1_CFG_t os1_cfg = {0};
+
+    os1_cfg.bits.OSC1_V = cfg.amplitude;
+    os1_cfg.bits.OSC1_I = cfg.dr_cu;
+    os1_cfg.bits.OSC1_LDO = cfg.ldo;
+
+    uint8_t data[2] = {0x23, 0x00};
+    data[1] = os1_cfg.byte;
+
+    return WriteConfig(handle, data, 2);
+}
+
+MC1081_Status_t MC1081_SingleOSCGet(MC1081_Handle_t handle, MC1081_SingleOSCCfg_t *cfg)
+{
+    MC1081_CHECKPTR(handle);
+    MC1081_CHECKPTR(cfg);
+
+    MC1081_OSC1_CFG_t os1_cfg = {0};
+
+    MC1081_Status_t sta = ReadConfig(handle, MC1081_REG_OSC1_CFG, &os1_cfg.byte, 1);
+    MC1081_CHECKERR(sta);
+    cfg->amplitude = os1_cfg.bits.OSC1_V;
+    cfg->dr_cu = os1_cfg.bits.OSC1_I;
+    cfg->ldo = os1_cfg.bits.OSC1_LDO;
+    return sta;
+}
+
+MC1081_Status_t MC1081_ChDiffEnableSet(MC1081_Handle_t handle, MC1081_ChDiffEn_t diffen)
+{
+    MC1081_CHECKPTR(handle);
+
+    uint8_t data[2] = {0x24, 0x00};
+    MC1081_OSC2_DCHS_t osc2_dchs = {0};
+
+    osc2_dchs.byte = diffen.value;
+    data[1] = osc2_dchs.byte;
+
+    return WriteConfig(handle, data, 2);
+}
+
+MC1081_Status_t MC1081_ChDiffEnableGet(MC1081_Handle_t handle, MC1081_ChDiffEn_t *diffen)
+{
+    MC1081_CHECKPTR(handle);
+    MC1081_CHECKPTR(diffen);
+
+    MC1081_OSC2_DCHS_t osc2_dchs = {0};
+
+    MC1081_Status_t sta = ReadConfig(handle, MC1081_REG_OSC2_DCHS, &osc2_dchs.byte, 1);
+    MC1081_CHECKERR(sta);
+
+    diffen->value = osc2_dchs.byte;
+    return sta;
+}
+
+MC1081_Status_t MC1081_DiffOSCSet(MC1081_Handle_t handle, MC1081_DiffOSCCfg_t cfg)
+{
+    MC1081_CHECKPTR(handle);
+
+    uint8_t data[2] = {0x25, 0x00};
+    MC1081_OSC2_CFG_t os2_cfg = {0};
+
+    os2_cfg.bits.OSC2_I = cfg.dr_cu;
+    os2_cfg.bits.OSC2_V = cfg.amplitude;
+    os2_cfg.bits.OSC2_LDO = cfg.ldo;
+
+    data[1] = os2_cfg.byte;
+
+    return WriteConfig(handle, data, 2);
+}
+
+MC1081_Status_t MC1081_DiffOSCGet(MC1081_Handle_t handle, MC1081_DiffOSCCfg_t *cfg)
+{
+    MC1081_CHECKPTR(handle);
+    MC1081_CHECKPTR(cfg);
+    
+    MC1081_OSC2_CFG_t os2_cfg = {0};
+
+    MC1081_Status_t sta = ReadConfig(handle, MC1081_REG_OSC2_CFG, &os2_cfg.byte, 1);
+    MC1081_CHECKERR(sta);
+
+    cfg->amplitude = os2_cfg.bits.OSC2_V;
+    cfg->dr_cu = os2_cfg.bits.OSC2_I;
+    cfg->ldo = os2_cfg.bits.OSC2_LDO;
+
+    return sta;
+}
+
+MC1081_Status_t MC1081_SoftWareReset(MC1081_Handle_t handle)
+{
+    MC1081_CHECKPTR(handle);
+
+    uint8_t data[2] = {0x69, 0x7A};
+
+    MC1081_Status_t sta = WriteByte(handle, data, 2);
+    MC1081_CHECKERR(sta);
+
+    handle->shadow_valid = 0; // 复位后寄存器回到默认值, 影子寄存器作废
+
+    return sta;
+}
+
+
+MC1081_Status_t MC1081_ActiveShieldSet(MC1081_Handle_t handle,MC1081_ActiveShielCfg cfg)
+{
+    MC1081_CHECKPTR(handle);
+
+    MC1081_SHLD_CFG_t shld_cfg = {0};
+    shld_cfg.bits.CS = cfg.sel;
+    shld_cfg.bits.SHLD_EN = cfg.en;
+    shld_cfg.bits.SHLD_HP = cfg.pwr;
+
+    uint8_t data[2] = {0x26,0x00};
+    data[1] = shld_cfg.byte;
+
+    return WriteConfig(handle,data,2);
+}
+
+MC1081_Status_t MC1081_ActiveShieldGet(MC1081_Handle_t handle,MC1081_ActiveShielCfg *cfg)
+{
+    MC1081_CHECKPTR(handle);
+    MC1081_CHECKPTR(cfg);
+
+    MC1081_SHLD_CFG_t shld_cfg = {0};
+    MC1081_Status_t sta = ReadConfig(handle,MC1081_REG_SHLD_CFG,&shld_cfg.byte,1);
+    MC1081_CHECKERR(sta);
+
+    cfg->pwr = shld_cfg.bits.SHLD_HP;
+    cfg->sel = shld_cfg.bits.CS;
+    cfg->en = shld_cfg.bits.SHLD_EN;
+
+    return sta;
+}
+
+MC1081_Status_t MC1081_SyncShadow(MC1081_Handle_t handle)
+{
+    MC1081_CHECKPTR(handle);
+
+    handle->shadow_valid = 0;
+
+    uint8_t data[MC1081_CFG_REG_NUM] = {0};
+    return ReadConfig(handle, MC1081_REG_T_CMD, data, MC1081_CFG_REG_NUM);
+}
+
+/**
+ * @brief 将完整配置编码为 0x1C ~ 0x26 的寄存器值
+ */
+void MC1081_DeviceConfigEncode(const MC1081_DeviceConfig_t *cfg, uint8_t *regs)
+{
+    MC1081_T_CMD_t t_cmd = {0};
+    t_cmd.bits.STC = cfg->temp_state;
+    t_cmd.bits.TCV = cfg->temp_time;
+
+    MC1081_C_CMD_t c_cmd = {0};
+    c_cmd.bits.CAVG = cfg->cap.avg_cycle;
+    c_cmd.bits.SLEEP_EN = cfg->cap.sleep;
+    c_cmd.bits.OSC_SEL = cfg->cap.osc_mode;
+    c_cmd.bits.CR = cfg->cap.interval;
+    c_cmd.bits.OS = cfg->cap.start;
+
+    MC1081_DIV_CFG_t div_cfg = {0};
+    div_cfg.bits.FINDIV = cfg->clock.fin_div;
+    div_cfg.bits.SETTLING = cfg->clock.fin_build;
+    div_cfg.bits.FREFDIV = cfg->clock.fref_div;
+
+    MC1081_OSC1_CFG_t os1_cfg = {0};
+    os1_cfg.bits.OSC1_V = cfg->osc1.amplitude;
+    os1_cfg.bits.OSC1_I = cfg->osc1.dr_cu;
+    os1_cfg.bits.OSC1_LDO = cfg->osc1.ldo;
+
+    MC1081_OSC2_CFG_t os2_cfg = {0};
+    os2_cfg.bits.OSC2_I = cfg->osc2.dr_cu;
+    os2_cfg.bits.OSC2_V = cfg->osc2.amplitude;
+    os2_cfg.bits.OSC2_LDO = cfg->osc2.ldo;
+
+    MC1081_SHLD_CFG_t shld_cfg = {0};
+    shld_cfg.bits.CS = cfg->shield.sel;
+    shld_cfg.bits.SHLD_EN = cfg->shield.en;
+    shld_cfg.bits.SHLD_HP = cfg->shield.pwr;
+
+    regs[MC1081_SHADOW_IDX(MC1081_REG_T_CMD)] = t_cmd.byte;
+    regs[MC1081_SHADOW_IDX(MC1081_REG_C_CMD)] = c_cmd.byte;
+    regs[MC1081_SHADOW_IDX(MC1081_REG_FIN_CNT)] = cfg->fin_cycle;
+    regs[MC1081_SHADOW_IDX(MC1081_REG_DIV_CFG)] = div_cfg.byte;
+    regs[MC1081_SHADOW_IDX(MC1081_REG_OSC1_CHS)] = (uint8_t)(cfg->ch_single.value & 0x00FF);
+    regs[MC1081_SHADOW_IDX(MC1081_REG_OSC1_CHS) + 1] = (uint8_t)((cfg->ch_single.value & 0xFF00) >> 8);
+    regs[MC1081_SHADOW_IDX(MC1081_REG_OSC1_MCHS)] = cfg->mch.value;
+    regs[MC1081_SHADOW_IDX(MC1081_REG_OSC1_CFG)] = os1_cfg.byte;
+    regs[MC1081_SHADOW_IDX(MC1081_REG_OSC2_DCHS)] = cfg->ch_diff.value;
+    regs[MC1081_SHADOW_IDX(MC1081_REG_OSC2_CFG)] = os2_cfg.byte;
+    regs[MC1081_SHADOW_IDX(MC1081_REG_SHLD_CFG)] = shld_cfg.byte;
+}
+
+/**
+ * @brief 由 0x1C ~ 0x26 的寄存器值解码完整配置
+ */
+void MC1081_DeviceConfigDecode(const uint8_t *regs, MC1081_DeviceConfig_t *cfg)
+{
+    MC1081_T_CMD_t t_cmd = {0};
+    t_cmd.byte = regs[MC1081_SHADOW_IDX(MC1081_REG_T_CMD)];
+    cfg->temp_state = (MC1081_TempConvState_t)t_cmd.bits.STC;
+    cfg->temp_time = (MC1081_TempTime_t)t_cmd.bits.TCV;
+
+    MC1081_C_CMD_t c_cmd = {0};
+    c_cmd.byte = regs[MC1081_SHADOW_IDX(MC1081_REG_C_CMD)];
+    cfg->cap.avg_cycle = c_cmd.bits.CAVG;
+    cfg->cap.interval = c_cmd.bits.CR;
+    cfg->cap.osc_mode = c_cmd.bits.OSC_SEL;
+    cfg->cap.sleep = c_cmd.bits.SLEEP_EN;
+    cfg->cap.start = c_cmd.bits.OS;
+
+    cfg->fin_cycle = regs[MC1081_SHADOW_IDX(MC1081_REG_FIN_CNT)];
+
+    MC1081_DIV_CFG_t div_cfg = {0};
+    div_cfg.byte = regs[MC1081_SHADOW_IDX(MC1081_REG_DIV_CFG)];
+    cfg->clock.fin_build = div_cfg.bits.SETTLING;
+    cfg->clock.fin_div = div_cfg.bits.FINDIV;
+    cfg->clock.fref_div = div_cfg.bits.FREFDIV;
+
+    cfg->ch_single.value = (uint16_t)(regs[MC1081_SHADOW_IDX(MC1081_REG_OSC1_CHS)] |
+                                      (regs[MC1081_SHADOW_IDX(MC1081_REG_OSC1_CHS) + 1] << 8));
+    cfg->mch.value = regs[MC1081_SHADOW_IDX(MC1081_REG_OSC1_MCHS)];
+
+    MC1081_OSC1_CFG_t os1_cfg = {0};
+    os1_cfg.byte = regs[MC1081_SHADOW_IDX(MC1081_REG_OSC1_CFG)];
+    cfg->osc1.amplitude = os1_cfg.bits.OSC1_V;
+    cfg->osc1.dr_cu = os1_cfg.bits.OSC1_I;
+    cfg->osc1.ldo = os1_cfg.bits.OSC1_LDO;
+
+    cfg->ch_diff.value = regs[MC1081_SHADOW_IDX(MC1081_REG_OSC2_DCHS)];
+
+    MC1081_OSC2_CFG_t os2_cfg = {0};
+    os2_cfg.byte = regs[MC1081_SHADOW_IDX(MC1081_REG_OSC2_CFG)];
+    cfg->osc2.amplitude = os2_cfg.bits.OSC2_V;
+    cfg->osc2.dr_cu = os2_cfg.bits.OSC2_I;
+    cfg->osc2.ldo = os2_cfg.bits.OSC2_LDO;
+
+    MC1081_SHLD_CFG_t shld_cfg = {0};
+    shld_cfg.byte = regs[MC1081_SHADOW_IDX(MC1081_REG_SHLD_CFG)];
+    cfg->shield.pwr = shld_cfg.bits.SHLD_HP;
+    cfg->shield.sel = shld_cfg.bits.CS;
+    cfg->shield.en = shld_cfg.bits.SHLD_EN;
+}
+
+MC1081_Status_t MC1081_DeviceConfigApply(MC1081_Handle_t handle, const MC1081_DeviceConfig_t *cfg)
+{
+    MC1081_CHECKPTR(cfg);
+
+    uint8_t regs[MC1081_CFG_REG_NUM] = {0};
+    MC1081_DeviceConfigEncode(cfg, regs);
+
+    return MC1081_DeviceConfigApplyRegs(handle, regs);
+}
+
+MC1081_Status_t MC1081_DeviceConfigApplyRegs(MC1081_Handle_t handle, const uint8_t *regs)
+{
+    MC1081_CHECKPTR(handle);
+    MC1081_CHECKPTR(regs);
+
+    uint8_t data[1 + MC1081_CFG_REG_NUM] = {0};
+    data[0] = MC1081_REG_T_CMD;
+    memcpy(&data[1], regs, MC1081_CFG_REG_NUM);
+
+    // 先在转换停止的状态下写入整块配置
+    uint8_t start[3] = {MC1081_REG_T_CMD, data[1], data[2]};
+
+    MC1081_T_CMD_t t_cmd = {0};
+    t_cmd.byte = start[1];
+    t_cmd.bits.STC = MC1081_TEMP_CONV_OFF;
+    data[1] = t_cmd.byte;
+
+    MC1081_C_CMD_t c_cmd = {0};
+    c_cmd.byte = start[2];
+    c_cmd.bits.OS = MC1081_CAP_START_STOP;
+    data[2] = c_cmd.byte;
+
+    MC1081_Status_t sta = WriteConfig(handle, data, sizeof(data));
+    MC1081_CHECKERR(sta);
+
+    // 最后写 T_CMD / C_CMD 启动转换
+    if (start[1] == data[1] && start[2] == data[2])
+        return sta;
+
+    return WriteConfig(handle, start, sizeof(start));
+}
+
+MC1081_Status_t MC1081_DeviceConfigGet(MC1081_Handle_t handle, MC1081_DeviceConfig_t *cfg)
+{
+    MC1081_CHECKPTR(handle);
+    MC1081_CHECKPTR(cfg);
+
+    uint8_t regs[MC1081_CFG_REG_NUM] = {0};
+    MC1081_Status_t sta = ReadConfig(handle, MC1081_REG_T_CMD, regs, MC1081_CFG_REG_NUM);
+    MC1081_CHECKERR(sta);
+
+    MC1081_DeviceConfigDecode(regs, cfg);
+
+    return sta;
+}
+
+/**
+ * @brief 将 dirty 中的脏寄存器合并为尽量少的突发写, 返回写出的寄存器个数
+ */
+static MC1081_Status_t WriteDirtyRuns(MC1081_Handle_t handle, const uint8_t *regs, uint16_t dirty, uint8_t *sent)
+{
+    uint8_t data[1 + MC1081_CFG_REG_NUM] = {0};
+    uint8_t i = 0;
+
+    while (i < MC1081_CFG_REG_NUM)
+    {
+        if (!(dirty & (1U << i)))
+        {
+            i++;
+            continue;
+        }
+
+        // 间隔不超过 MC1081_CFG_MERGE_GAP 个未变寄存器的两段合并为一次写
+        uint8_t end = i;
+        for (uint8_t j = (uint8_t)(i + 1); j < MC1081_CFG_REG_NUM && j - end <= MC1081_CFG_MERGE_GAP + 1; j++)
+        {
+            if (dirty & (1U << j))
+                end = j;
+        }
+
+        const uint8_t len = (uint8_t)(end - i + 1);
+        data[0] = (uint8_t)(MC1081_REG_T_CMD + i);
+        memcpy(&data[1], &regs[i], len);
+
+        MC1081_Status_t sta = WriteConfig(handle, data, 1U + len);
+        MC1081_CHECKERR(sta);
+
+        *sent = (uint8_t)(*sent + len);
+        i = (uint8_t)(end + 1);
+    }
+
+    return MC1081_OK;
+}
+
+MC1081_Status_t MC1081_DeviceConfigUpdate(MC1081_Handle_t handle, const MC1081_DeviceConfig_t *cfg, uint8_t *skipped)
+{
+    MC1081_CHECKPTR(cfg);
+
+    uint8_t regs[MC1081_CFG_REG_NUM] = {0};
+    MC1081_DeviceConfigEncode(cfg, regs);
+
+    return MC1081_DeviceConfigUpdateRegs(handle, regs, skipped);
+}
+
+MC1081_Status_t MC1081_DeviceConfigUpdateRegs(MC1081_Handle_t handle, const uint8_t *regs, uint8_t *skipped)
+{
+    MC1081_CHECKPTR(handle);
+    MC1081_CHECKPTR(regs);
+
+    // 影子寄存器经过一次编解码再比较: 读回的保留位 / 默认位不应使寄存器变脏
+    MC1081_DeviceConfig_t cur;
+    uint8_t norm[MC1081_CFG_REG_NUM];
+    MC1081_DeviceConfigDecode(handle->shadow, &cur);
+    MC1081_DeviceConfigEncode(&cur, norm);
+
+    uint16_t dirty = 0;
+    for (uint8_t i = 0; i < MC1081_CFG_REG_NUM; i++)
+    {
+        if (!(handle->shadow_valid & (1U << i)) || norm[i] != regs[i])
+            dirty |= (uint16_t)(1U << i);
+    }
+
+    // 命令寄存器最后写, 转换在其余配置就位后才按新设置运行
+    const uint16_t cmd = MC1081_SHADOW_MASK(MC1081_REG_T_CMD, 2);
+    uint8_t sent = 0;
+
+    MC1081_Status_t sta = WriteDirtyRuns(handle, regs, dirty & (uint16_t)~cmd, &sent);
+    if (sta == MC1081_OK)
+        sta = WriteDirtyRuns(handle, regs, dirty & cmd, &sent);
+
+    if (skipped != NULL)
+        *skipped = (uint8_t)(MC1081_CFG_REG_NUM - sent);
+
+    return sta;
+}
+
+MC1081_Status_t MC1081_DeInit(MC1081_Handle_t *handle)
+{
+    MC1081_CHECKPTR(handle);
+    MC1081_CHECKPTR(*handle);
+
+    if ((*handle)->origin == MC1081_OBJ_FREE)
+        return MC1081_PARAM_ERR;
+
+    ObjFree(*handle);
+    *handle = NULL;
+
+    return MC1081_OK;
+}
+
+uint8_t MC1081_CalI2cAddr(MC1081_AddrSel_t add)
+{
+    add.bits.RSV = 0x07;
+    return add.value;
+}
+
+/* 异步请求状态机: IDLE -> ADDR (写寄存器地址) -> DATA (读数据) -> IDLE */
+#define MC1081_ASYNC_IDLE (0)
+#define MC1081_ASYNC_ADDR (1)
+#define MC1081_ASYNC_DATA (2)
+
+static void AsyncFinish(MC1081_Handle_t handle, MC1081_Status_t sta)
+{
+    MC1081_AsyncCtx_t *a = &handle->async;
+
+    if (sta == MC1081_OK)
+    {
+        MC1081_CHDATA_t data = {0};
+        MC1081_STATUSReg_t status = {0};
+
+        switch (a->kind)
+        {
+        case MC1081_ASYNC_SNAPSHOT:
+            StampRead(handle, handle->time.request_ns, ClockNow(handle));
+            DecodeResultBlock(a->buf, a->out);
+            StatusSeen(handle, a->out->isCapConverting, a->out->isTempConverting);
+            sta = RunStages(handle, a->out);
+            break;
+        case MC1081_ASYNC_CHANNEL:
+            data.bits.D_MSB = a->buf[0];
+            data.bits.D_LSB = a->buf[1];
+            a->out->ch[a->ch] = data.bytes;
+            break;
+        case MC1081_ASYNC_MCH:
+            data.bits.D_MSB = a->buf[0];
+            data.bits.D_LSB = a->buf[1];
+            a->out->mch[a->ch] = data.bytes;
+            break;
+        default:
+            status.byte = a->buf[0];
+            a->out->isCapConverting = status.bits.FLAG_CCVT;
+            a->out->isTempConverting = status.bits.FLAG_TCVT;
+            StatusSeen(handle, status.bits.FLAG_CCVT, status.bits.FLAG_TCVT);
+            break;
+        }
+    }
+
+    a->sta = sta;
+    a->state = MC1081_ASYNC_IDLE;
+
+    if (a->done != NULL)
+        a->done(a->user, a->token, sta);
+}
+
+MC1081_Status_t MC1081_AsyncAttach(MC1081_Handle_t handle, const MC1081_AsyncBus_t *bus)
+{
+    MC1081_CHECKPTR(handle);
+    MC1081_CHECKPTR(bus);
+
+    if (bus->StartWrite == NULL || bus->StartRead == NULL)
+        return MC1081_ERR;
+
+    if (handle->async.state != MC1081_ASYNC_IDLE)
+        return MC1081_BUSY_ERR;
+
+    handle->abus = *bus;
+    return MC1081_OK;
 }
 
-MC1081_Status_t MC1081_CapMeasureGet(MC1081_Handle_t handle, MC1081_CapConvConfig_t *conf)
+MC1081_Status_t MC1081_AsyncStart(MC1081_Handle_t handle, MC1081_AsyncKind_t kind, uint8_t ch,
+                                  MC1081_Snapshot_t *out, MC1081_AsyncDoneFunc_t done, void *user, uint32_t *token)
 {
     MC1081_CHECKPTR(handle);
-    MC1081_CHECKPTR(conf);
+    MC1081_CHECKPTR(out);
 
-    uint8_t reg_addr = 0x1D;
+    if (handle->abus.StartWrite == NULL)
+        return MC1081_ERR;
 
-    MC1081_Status_t sta = WriteByte(handle, &reg_addr, 1);
-    MC1081_CHECKERR(sta);
+    MC1081_AsyncCtx_t *a = &handle->async;
+    if (a->state != MC1081_ASYNC_IDLE)
+        return MC1081_BUSY_ERR;
 
-    MC1081_C_CMD_t c_cmd = {0};
-    sta = ReadByte(handle, &c_cmd.byte, 1);
-    MC1081_CHECKERR(sta);
+    switch (kind)
+    {
+    case MC1081_ASYNC_SNAPSHOT:
+        a->reg = MC1081_REG_TDATA;
+        a->len = MC1081_RESULT_REG_NUM;
+        break;
+    case MC1081_ASYNC_CHANNEL:
+        if (ch >= MC1081_CH_NUM)
+            return MC1081_PARAM_ERR;
+        a->reg = (uint8_t)((2 * ch) + 2);
+        a->len = 2;
+        break;
+    case MC1081_ASYNC_MCH:
+        if (ch >= MC1081_MCH_NUM)
+            return MC1081_PARAM_ERR;
+        a->reg = (uint8_t)((4 * ch) + 4);
+        a->len = 2;
+        break;
+    case MC1081_ASYNC_STATUS:
+        a->reg = MC1081_REG_STATUS;
+        a->len = 1;
+        break;
+    default:
+        return MC1081_PARAM_ERR;
+    }
 
-    conf->avg_cycle = c_cmd.bits.CAVG;
-    conf->interval = c_cmd.bits.CR;
-    conf->osc_mode = c_cmd.bits.OSC_SEL;
-    conf->sleep = c_cmd.bits.SLEEP_EN;
-    conf->start = c_cmd.bits.OS;
+    a->kind = (uint8_t)kind;
+    a->ch = ch;
+    a->out = out;
+    a->done = done;
+    a->user = user;
+    if (++a->token == 0)
+        a->token = 1;
+    if (token != NULL)
+        *token = a->token;
+
+    if (kind == MC1081_ASYNC_SNAPSHOT)
+        handle->time.request_ns = ClockNow(handle);
+
+    MC1081_STAT_BEGIN(handle);
+    MC1081_STAT_ADD(handle, tx, 1);
+    MC1081_STAT_ADD(handle, wr_bytes, 1);
+
+    a->state = MC1081_ASYNC_ADDR; // 先置状态, 传输可能在 StartWrite 内部就完成
+    const MC1081_Status_t sta = BusStatus(handle->abus.StartWrite(handle->abus.ctx, handle->I2c_addr, &a->reg, 1), MC1081_WR_ERR);
+    if (sta != MC1081_OK)
+    {
+        MC1081_STAT_ADD(handle, wr_err, 1);
+        MC1081_STAT_ERR(handle, sta);
+        a->sta = sta;
+        a->state = MC1081_ASYNC_IDLE;
+        return sta;
+    }
 
-    return sta;
+    return MC1081_OK;
 }
 
-/**
- * @brief 设定 fin 的测量周期个数 N
- *
- * @param handle
- * @param cycle
- * @return MC1081_Status_t
- */
-MC1081_Status_t MC1081_SetFinCycle(MC1081_Handle_t handle, uint8_t cycle)
+void MC1081_AsyncOnComplete(MC1081_Handle_t handle, int result)
 {
-    MC1081_CHECKPTR(handle);
+    if (handle == NULL)
+        return;
 
-    uint8_t data[2] = {0x1E, 0x00};
-    data[1] = cycle;
+    MC1081_AsyncCtx_t *a = &handle->async;
+    MC1081_Status_t sta = MC1081_OK;
 
-    return WriteByte(handle, data, 2);
+    switch (a->state)
+    {
+    case MC1081_ASYNC_ADDR:
+        sta = BusStatus(result, MC1081_WR_ERR);
+        if (sta != MC1081_OK)
+        {
+            MC1081_STAT_ADD(handle, wr_err, 1);
+            MC1081_STAT_ERR(handle, sta);
+            AsyncFinish(handle, sta);
+            break;
+        }
+        a->state = MC1081_ASYNC_DATA;
+        MC1081_STAT_ADD(handle, tx, 1);
+        MC1081_STAT_ADD(handle, rd_bytes, a->len);
+        sta = BusStatus(handle->abus.StartRead(handle->abus.ctx, handle->I2c_addr, a->buf, a->len), MC1081_RR_ERR);
+        if (sta != MC1081_OK)
+        {
+            MC1081_STAT_ADD(handle, rd_err, 1);
+            MC1081_STAT_ERR(handle, sta);
+            AsyncFinish(handle, sta);
+        }
+        break;
+
+    case MC1081_ASYNC_DATA:
+        sta = BusStatus(result, MC1081_RR_ERR);
+        if (sta != MC1081_OK)
+        {
+            MC1081_STAT_ADD(handle, rd_err, 1);
+            MC1081_STAT_ERR(handle, sta);
+            AsyncFinish(handle, sta);
+            break;
+        }
+        MC1081_STAT_TIME(handle, MC1081_OP_READ, handle->stats_t0, ClockNow(handle));
+        AsyncFinish(handle, MC1081_OK);
+        break;
+
+    default:
+        break;
+    }
 }
 
-MC1081_Status_t MC1081_GetFinCycle(MC1081_Handle_t handle, uint8_t *cycle)
+MC1081_Status_t MC1081_AsyncPoll(MC1081_Handle_t handle, uint32_t token)
 {
     MC1081_CHECKPTR(handle);
-    MC1081_CHECKPTR(cycle);
 
-    uint8_t data[2] = {0x1E, 0x00};
+    const MC1081_AsyncCtx_t *a = &handle->async;
 
-    MC1081_Status_t sta = WriteByte(handle, &data[0], 1);
-    MC1081_CHECKERR(sta);
+    if (token == 0 || token != a->token)
+        return MC1081_PARAM_ERR;
 
-    sta = ReadByte(handle, &data[1], 1);
-    MC1081_CHECKERR(sta);
+    return (a->state != MC1081_ASYNC_IDLE) ? MC1081_BUSY_ERR : a->sta;
+}
 
-    *cycle = data[1];
+static const uint8_t s_avg_cycles[] = {1, 4, 8, 32};
 
-    return sta;
-}
+/* 周期测量间隔, us, 对应 MC1081_CapTime_t, 连续模式为 0 */
+static const uint32_t s_interval_us[] = {10000000UL, 1000000UL, 100000UL, 0UL};
 
 /**
- * @brief 时钟配置
+ * @brief 估算单个通道一次转换的时间
  *
- * @return MC1081_Status_t
+ * 计数值即测量期间分频后参考时钟的周期数, 故测量时间 = count * 2^FREFDIV / f_ref;
+ * 建立时间按同一 f_in 折算. 没有有效计数时按标称 f_in 估算.
  */
-MC1081_Status_t MC1081_SetClockConfig(MC1081_Handle_t handle, MC1081_ClockCfg_t cfg)
+static uint64_t ChannelTimeNs(uint32_t fref_hz, uint16_t count, uint32_t fin_cycles, uint8_t frefdiv, uint8_t settle)
 {
-    MC1081_CHECKPTR(handle);
+    uint64_t meas_ns = 0;
 
-    MC1081_DIV_CFG_t div_cfg = {0};
-
-    div_cfg.bits.FINDIV = cfg.fin_div;
-    div_cfg.bits.SETTLING = cfg.fin_build;
-    div_cfg.bits.FREFDIV = cfg.fref_div;
+    if (count != 0 && count != 0xFFFF)
+        meas_ns = ((uint64_t)count * (1000000000ULL << frefdiv)) / fref_hz;
+    else
+        meas_ns = ((uint64_t)fin_cycles * 1000000000ULL) / MC1081_FIN_NOMINAL_HZ;
 
-    uint8_t data[2] = {0x1F, 0x00};
-    data[1] = div_cfg.byte;
-    return WriteByte(handle, data, 2);
+    return meas_ns + (meas_ns * settle) / fin_cycles;
 }
 
-MC1081_Status_t MC1081_GetClockConfig(MC1081_Handle_t handle, MC1081_ClockCfg_t *cfg)
+MC1081_Status_t MC1081_SetClock(MC1081_Handle_t handle, MC1081_ClockFunc_t clock, void *ctx)
 {
     MC1081_CHECKPTR(handle);
-    MC1081_CHECKPTR(cfg);
 
-    MC1081_DIV_CFG_t div_cfg = {0};
+    handle->clock = clock;
+    handle->clock_ctx = ctx;
+    memset(&handle->time, 0, sizeof(MC1081_FrameTime_t));
 
-    uint8_t reg_addr = 0x1F;
-    MC1081_Status_t sta = WriteByte(handle, &reg_addr, 1);
-    MC1081_CHECKERR(sta);
+    return MC1081_OK;
+}
 
-    sta = ReadByte(handle, &div_cfg.byte, 1);
-    MC1081_CHECKERR(sta);
+MC1081_Status_t MC1081_LastFrameTime(MC1081_Handle_t handle, MC1081_FrameTime_t *time)
+{
+    MC1081_CHECKPTR(handle);
+    MC1081_CHECKPTR(time);
 
-    cfg->fin_build = div_cfg.bits.SETTLING;
-    cfg->fin_div = div_cfg.bits.FINDIV;
-    cfg->fref_div = div_cfg.bits.FREFDIV;
+    *time = handle->time;
 
-    return sta;
+    return MC1081_OK;
 }
 
-MC1081_Status_t MC1081_ChSingleEnableSet(MC1081_Handle_t handle, MC1081_ChSingleEn_t ChSingle)
+MC1081_Status_t MC1081_ReadFrame(MC1081_Handle_t handle, const MC1081_ScanPlan_t *plan, MC1081_Frame_t *frame)
 {
     MC1081_CHECKPTR(handle);
+    MC1081_CHECKPTR(frame);
 
-    MC1081_OSC1_CHS_t osc1_chs = {0};
-
-    osc1_chs.bytes = ChSingle.value;
+    MC1081_Status_t sta = (plan != NULL) ? MC1081_ScanRead(handle, plan, &frame->data) : MC1081_ReadSnapshot(handle, &frame->data);
 
-    uint8_t data[3] = {0x20, 0x00, 0x00};
-    data[1] = (uint8_t)(osc1_chs.bytes & 0x00FF);
-    data[2] = (uint8_t)((osc1_chs.bytes & 0xFF00) >> 8);
+    if (sta == MC1081_OK || sta == MC1081_DROP_ERR) // 被丢弃的帧也带上时间, 便于统计
+    {
+        frame->time = handle->time;
+        frame->timestamp = handle->time.bus_ns;
+    }
 
-    return WriteByte(handle, data, 3);
+    return sta;
 }
 
-MC1081_Status_t MC1081_ChSingleEnableGet(MC1081_Handle_t handle, MC1081_ChSingleEn_t *ChSingle)
+MC1081_Status_t MC1081_SetRetryPolicy(MC1081_Handle_t handle, const MC1081_RetryPolicy_t *policy)
 {
     MC1081_CHECKPTR(handle);
-    MC1081_CHECKPTR(ChSingle);
-
-    MC1081_OSC1_CHS_t osc1_chs = {0};
 
-    uint8_t reg_addr = 0x20;
-    MC1081_Status_t sta = WriteByte(handle, &reg_addr, 1);
-    MC1081_CHECKERR(sta);
+    if (policy == NULL)
+        memset(&handle->retry, 0, sizeof(MC1081_RetryPolicy_t));
+    else
+        handle->retry = *policy;
 
-    sta = ReadByte(handle, (uint8_t *)&osc1_chs.bytes, 2);
-    MC1081_CHECKERR(sta);
+    return MC1081_OK;
+}
 
-    ChSingle->value = osc1_chs.bytes;
+MC1081_Status_t MC1081_SetDeadline(MC1081_Handle_t handle, uint64_t deadline_ns)
+{
+    MC1081_CHECKPTR(handle);
 
-    return sta;
+    handle->deadline_ns = deadline_ns;
+    return MC1081_OK;
 }
 
-MC1081_Status_t MC1081_MchxEnableSet(MC1081_Handle_t handle, MC1081_MchEn_t Mchx)
+MC1081_Status_t MC1081_StatsGet(MC1081_Handle_t handle, MC1081_Stats_t *stats)
 {
     MC1081_CHECKPTR(handle);
+    MC1081_CHECKPTR(stats);
 
-    MC1081_OSC1_MCHS_t osc1_mchs = {0};
+#if MC1081_USE_STATS
+    *stats = handle->stats;
+    return MC1081_OK;
+#else
+    memset(stats, 0, sizeof(MC1081_Stats_t));
+    return MC1081_ERR;
+#endif
+}
 
-    uint8_t reg_addr = 0x22;
-    osc1_mchs.byte = Mchx.value;
+MC1081_Status_t MC1081_StatsReset(MC1081_Handle_t handle)
+{
+    MC1081_CHECKPTR(handle);
 
-    uint8_t data[2] = {0};
-    data[0] = reg_addr;
-    data[1] = osc1_mchs.byte;
-    return WriteByte(handle, data, 2);
+#if MC1081_USE_STATS
+    memset(&handle->stats, 0, sizeof(MC1081_Stats_t));
+    return MC1081_OK;
+#else
+    return MC1081_ERR;
+#endif
 }
 
-MC1081_Status_t MC1081_MchxEnableGet(MC1081_Handle_t handle, MC1081_MchEn_t *Mchx)
+/**
+ * @brief 对数线性分桶: 小于 2^SUB_BITS 时一值一桶, 之上每个 2 的幂分 2^SUB_BITS 桶
+ */
+static uint32_t HistBin(uint32_t v)
 {
-    MC1081_CHECKPTR(handle);
-    MC1081_CHECKPTR(Mchx);
+    if (v < MC1081_LAT_SUB)
+        return v;
 
-    MC1081_OSC1_MCHS_t osc1_mchs = {0};
+    const uint32_t e = 31U - (uint32_t)__builtin_clz(v);
+    const uint32_t sh = e - MC1081_LAT_SUB_BITS;
 
-    uint8_t reg_addr = 0x22;
+    return ((sh + 1U) << MC1081_LAT_SUB_BITS) + ((v >> sh) & MC1081_LAT_SUB_MASK);
+}
 
-    MC1081_Status_t sta = WriteByte(handle, &reg_addr, 1);
-    MC1081_CHECKERR(sta);
+/**
+ * @brief 桶的上边界 (含)
+ */
+static uint32_t HistBinUpper(uint32_t idx)
+{
+    if (idx < MC1081_LAT_SUB)
+        return idx;
 
-    sta = ReadByte(handle, &osc1_mchs.byte, 1);
-    MC1081_CHECKERR(sta);
+    const uint32_t sh = (idx >> MC1081_LAT_SUB_BITS) - 1U;
+    const uint64_t lower = (uint64_t)(MC1081_LAT_SUB + (idx & MC1081_LAT_SUB_MASK)) << sh;
+    const uint64_t upper = lower + (1ULL << sh) - 1U;
 
-    Mchx->value = osc1_mchs.byte;
-    return sta;
+    return (upper > 0xFFFFFFFFULL) ? 0xFFFFFFFFUL : (uint32_t)upper;
 }
 
-MC1081_Status_t MC1081_SingleOSCSet(MC1081_Handle_t handle, MC1081_SingleOSCCfg_t cfg)
+void MC1081_LatHistAdd(MC1081_LatHist_t *hist, uint64_t ns)
 {
-    MC1081_CHECKPTR(handle);
-
-    MC1081_OSC1_CFG_t os1_cfg = {0};
+    if (hist == NULL)
+        return;
 
-    os1_cfg.bits.OSC1_V = cfg.amplitude;
-    os1_cfg.bits.OSC1_I = cfg.dr_cu;
-    os1_cfg.bits.OSC1_LDO = cfg.ldo;
+    const uint32_t v = (ns > 0xFFFFFFFFULL) ? 0xFFFFFFFFUL : (uint32_t)ns;
 
-    uint8_t data[2] = {0x23, 0x00};
-    data[1] = os1_cfg.byte;
+    if (hist->count == 0 || v < hist->min_ns)
+        hist->min_ns = v;
+    if (v > hist->max_ns)
+        hist->max_ns = v;
 
-    return WriteByte(handle, data, 2);
+    hist->bin[HistBin(v)]++;
+    hist->count++;
 }
 
-MC1081_Status_t MC1081_SingleOSCGet(MC1081_Handle_t handle, MC1081_SingleOSCCfg_t *cfg)
+uint32_t MC1081_LatHistPercentile(const MC1081_LatHist_t *hist, uint16_t permille)
 {
-    MC1081_CHECKPTR(handle);
-    MC1081_CHECKPTR(cfg);
+    if (hist == NULL || hist->count == 0)
+        return 0;
 
-    uint8_t reg_addr = 0x23;
-    MC1081_OSC1_CFG_t os1_cfg = {0};
+    if (permille > 1000)
+        permille = 1000;
 
-    MC1081_Status_t sta = WriteByte(handle, &reg_addr, 1);
-    MC1081_CHECKERR(sta);
+    // 第 rank 个样本 (从 1 计) 所在的桶, 向上取整
+    uint64_t rank = ((uint64_t)hist->count * permille + 999U) / 1000U;
+    if (rank == 0)
+        rank = 1;
 
-    sta = ReadByte(handle, &os1_cfg.byte, 1);
-    MC1081_CHECKERR(sta);
-    cfg->amplitude = os1_cfg.bits.OSC1_V;
-    cfg->dr_cu = os1_cfg.bits.OSC1_I;
-    cfg->ldo = os1_cfg.bits.OSC1_LDO;
-    return sta;
+    uint64_t seen = 0;
+    for (uint32_t i = 0; i < MC1081_LAT_BINS; i++)
+    {
+        seen += hist->bin[i];
+        if (seen >= rank)
+        {
+            const uint32_t upper = HistBinUpper(i);
+            return (upper < hist->max_ns) ? upper : hist->max_ns;
+        }
+    }
+
+    return hist->max_ns;
 }
 
-MC1081_Status_t MC1081_ChDiffEnableSet(MC1081_Handle_t handle, MC1081_ChDiffEn_t diffen)
+uint32_t MC1081_StatsPercentile(const MC1081_Stats_t *stats, MC1081_OpClass_t op, uint16_t permille)
 {
-    MC1081_CHECKPTR(handle);
-
-    uint8_t data[2] = {0x24, 0x00};
-    MC1081_OSC2_DCHS_t osc2_dchs = {0};
-
-    osc2_dchs.byte = diffen.value;
-    data[1] = osc2_dchs.byte;
+    if (stats == NULL || (unsigned)op >= MC1081_OP_NUM)
+        return 0;
 
-    return WriteByte(handle, data, 2);
+    return MC1081_LatHistPercentile(&stats->hist[op], permille);
 }
 
-MC1081_Status_t MC1081_ChDiffEnableGet(MC1081_Handle_t handle, MC1081_ChDiffEn_t *diffen)
+MC1081_Status_t MC1081_SetRefClock(MC1081_Handle_t handle, uint32_t fref_hz)
 {
     MC1081_CHECKPTR(handle);
-    MC1081_CHECKPTR(diffen);
 
-    uint8_t reg_addr = 0x24;
-    MC1081_OSC2_DCHS_t osc2_dchs = {0};
+    if (fref_hz == 0)
+        return MC1081_PARAM_ERR;
 
-    MC1081_Status_t sta = WriteByte(handle, &reg_addr, 1);
-    MC1081_CHECKERR(sta);
+    handle->fref_hz = fref_hz;
+    return MC1081_OK;
+}
 
-    sta = ReadByte(handle, &osc2_dchs.byte, 1);
+/**
+ * @brief 按当前配置预测一帧的转换时间 (不含余量) 与新数据的间隔, 不修改句柄
+ */
+static MC1081_Status_t PredictFrame(MC1081_Handle_t handle, const MC1081_Snapshot_t *last, uint64_t *frame_ns, uint64_t *period_ns)
+{
+    uint8_t cfg[MC1081_CFG_REG_NUM] = {0};
+    MC1081_Status_t sta = ReadConfig(handle, MC1081_REG_T_CMD, cfg, MC1081_CFG_REG_NUM);
     MC1081_CHECKERR(sta);
 
-    diffen->value = osc2_dchs.byte;
+    MC1081_T_CMD_t t_cmd = {0};
+    MC1081_C_CMD_t c_cmd = {0};
+    MC1081_DIV_CFG_t div_cfg = {0};
+    t_cmd.byte = cfg[MC1081_SHADOW_IDX(MC1081_REG_T_CMD)];
+    c_cmd.byte = cfg[MC1081_SHADOW_IDX(MC1081_REG_C_CMD)];
+    div_cfg.byte = cfg[MC1081_SHADOW_IDX(MC1081_REG_DIV_CFG)];
+
+    uint32_t fin_cycles = cfg[MC1081_SHADOW_IDX(MC1081_REG_FIN_CNT)];
+    if (fin_cycles == 0)
+        fin_cycles = 1;
+    fin_cycles <<= div_cfg.bits.FINDIV;
+
+    const uint8_t settle = div_cfg.bits.SETTLING ? 4 : 1;
+    uint64_t total_ns = 0;
+
+    if (c_cmd.bits.OSC_SEL == MC1081_CAP_OSC_DIFF)
+    {
+        const uint8_t dchs = cfg[MC1081_SHADOW_IDX(MC1081_REG_OSC2_DCHS)];
+        for (uint8_t i = 0; i <= MC1081_DCH_DIFF_REF; i++)
+        {
+            if (dchs & (1U << i))
+                total_ns += ChannelTimeNs(handle->fref_hz, (last != NULL) ? last->ch[i] : 0, fin_cycles, div_cfg.bits.FREFDIV, settle);
+        }
+    }
+    else
+    {
+        const uint16_t chs = (uint16_t)(cfg[MC1081_SHADOW_IDX(MC1081_REG_OSC1_CHS)] | (cfg[MC1081_SHADOW_IDX(MC1081_REG_OSC1_CHS) + 1] << 8));
+        for (uint8_t i = 0; i < MC1081_CH_NUM; i++)
+        {
+            if (chs & (1U << i))
+                total_ns += ChannelTimeNs(handle->fref_hz, (last != NULL) ? last->ch[i] : 0, fin_cycles, div_cfg.bits.FREFDIV, settle);
+        }
+
+        const uint8_t mchs = cfg[MC1081_SHADOW_IDX(MC1081_REG_OSC1_MCHS)];
+        for (uint8_t i = 0; i < MC1081_MCH_NUM; i++)
+        {
+            if (mchs & (1U << i))
+                total_ns += ChannelTimeNs(handle->fref_hz, (last != NULL) ? last->mch[i] : 0, fin_cycles, div_cfg.bits.FREFDIV, settle);
+        }
+    }
+
+    total_ns *= s_avg_cycles[c_cmd.bits.CAVG];
+
+    if (t_cmd.bits.STC) // 温度与电容同时转换, 取较长者
+    {
+        const uint64_t temp_ns = (t_cmd.bits.TCV == MC1081_TEMP_TIME_0P3_MS) ? 300000ULL : 1700000ULL;
+        if (temp_ns > total_ns)
+            total_ns = temp_ns;
+    }
+
+    // 周期模式下新数据的间隔至少为一个测量间隔
+    *frame_ns = total_ns;
+    *period_ns = total_ns;
+    if (c_cmd.bits.OS == MC1081_CAP_START_PERIODIC && (uint64_t)s_interval_us[c_cmd.bits.CR] * 1000ULL > total_ns)
+        *period_ns = (uint64_t)s_interval_us[c_cmd.bits.CR] * 1000ULL;
+
     return sta;
 }
 
-MC1081_Status_t MC1081_DiffOSCSet(MC1081_Handle_t handle, MC1081_DiffOSCCfg_t cfg)
+/**
+ * @brief 预测时间加余量, 向上取整为 us
+ */
+static uint32_t PredictUs(uint64_t frame_ns)
 {
-    MC1081_CHECKPTR(handle);
-
-    uint8_t data[2] = {0x25, 0x00};
-    MC1081_OSC2_CFG_t os2_cfg = {0};
+    frame_ns += (frame_ns * MC1081_PREDICT_MARGIN_PCT) / 100U;
+    return (uint32_t)((frame_ns + 999ULL) / 1000ULL);
+}
 
-    os2_cfg.bits.OSC2_I = cfg.dr_cu;
-    os2_cfg.bits.OSC2_V = cfg.amplitude;
-    os2_cfg.bits.OSC2_LDO = cfg.ldo;
+MC1081_Status_t MC1081_PredictFrameTime(MC1081_Handle_t handle, const MC1081_Snapshot_t *last, uint32_t *us)
+{
+    MC1081_CHECKPTR(handle);
+    MC1081_CHECKPTR(us);
 
-    data[1] = os2_cfg.byte;
+    uint64_t frame_ns = 0;
+    uint64_t period_ns = 0;
+    MC1081_Status_t sta = PredictFrame(handle, last, &frame_ns, &period_ns);
+    MC1081_CHECKERR(sta);
 
-    return WriteByte(handle, data, 2);
+    *us = PredictUs(frame_ns);
+    return sta;
 }
 
-MC1081_Status_t MC1081_DiffOSCGet(MC1081_Handle_t handle, MC1081_DiffOSCCfg_t *cfg)
+MC1081_Status_t MC1081_AcquireBegin(MC1081_Handle_t handle, const MC1081_Snapshot_t *last, uint32_t *wait_us)
 {
     MC1081_CHECKPTR(handle);
-    MC1081_CHECKPTR(cfg);
-    
-    MC1081_OSC2_CFG_t os2_cfg = {0};
+    MC1081_CHECKPTR(wait_us);
+
+    if (handle->bus.Delay == NULL)
+        return MC1081_ERR;
 
-    uint8_t reg_addr = 0x25;
+    handle->acq_state = MC1081_ACQ_IDLE;
 
-    MC1081_Status_t sta = WriteByte(handle, &reg_addr, 1);
+    uint64_t frame_ns = 0;
+    uint64_t period_ns = 0;
+    MC1081_Status_t sta = PredictFrame(handle, last, &frame_ns, &period_ns);
     MC1081_CHECKERR(sta);
 
-    sta = ReadByte(handle, &os2_cfg.byte, 1);
+    // 帧时间估计 (见 StampRead 与 MC1081_AcquireFinish) 使用此间隔
+    handle->period_ns = period_ns;
+    *wait_us = PredictUs(frame_ns);
+
+    uint8_t cmd[2] = {0};
+    sta = ReadConfig(handle, MC1081_REG_T_CMD, cmd, 2);
     MC1081_CHECKERR(sta);
 
-    cfg->amplitude = os2_cfg.bits.OSC2_V;
-    cfg->dr_cu = os2_cfg.bits.OSC2_I;
-    cfg->ldo = os2_cfg.bits.OSC2_LDO;
+    MC1081_T_CMD_t t_cmd = {0};
+    MC1081_C_CMD_t c_cmd = {0};
+    t_cmd.byte = cmd[0];
+    c_cmd.byte = cmd[1];
+
+    const uint64_t now_ns = ClockNow(handle);
+
+    if (c_cmd.bits.OS == MC1081_CAP_START_PERIODIC)
+    {
+        // 周期模式下 CCVT 一直为 1: 新数据在上一帧完成后一个周期到来. 上一帧完成于上次读取的
+        // 请求之前, 以此上界 (而非估计的中点) 为基准才不会再读到同一帧;
+        // 没有时钟或上一帧时, 等待一个完整周期保证读到新数据
+        if (now_ns != 0 && handle->time.request_ns != 0)
+        {
+            const uint64_t next_ns = handle->time.request_ns + period_ns;
+            *wait_us = (next_ns > now_ns) ? (uint32_t)((next_ns - now_ns + 999ULL) / 1000ULL) : 0;
+        }
+        else if (s_interval_us[c_cmd.bits.CR] > *wait_us)
+        {
+            *wait_us = s_interval_us[c_cmd.bits.CR];
+        }
+        handle->acq_state = MC1081_ACQ_PERIODIC;
+    }
+    else
+    {
+        uint8_t data[2] = {MC1081_REG_C_CMD, 0x00};
+        c_cmd.bits.OS = MC1081_CAP_START_SINGLE;
+        data[1] = c_cmd.byte;
+        sta = WriteConfig(handle, data, 2);
+        MC1081_CHECKERR(sta);
+        handle->acq_state = MC1081_ACQ_SINGLE;
+#if MC1081_USE_STATS
+        handle->stats_busy |= MC1081_STAT_BUSY_CAP; // 已启动, 即使首次确认读就已完成也计一次转换
+#endif
+    }
+
+    // 单次转换从此刻开始, 预计在 acq_start_ns + period_ns (不含余量的预测) 完成
+    handle->acq_start_ns = ClockNow(handle);
+    handle->acq_wait_us = *wait_us;
+    handle->acq_temp = t_cmd.bits.STC; // 温度随帧转换, 读到 TCVT 清零才算本帧完成
 
     return sta;
 }
 
-MC1081_Status_t MC1081_SoftWareReset(MC1081_Handle_t handle)
+MC1081_Status_t MC1081_AcquireFinish(MC1081_Handle_t handle, const MC1081_ScanPlan_t *plan, MC1081_Snapshot_t *snap)
 {
     MC1081_CHECKPTR(handle);
+    MC1081_CHECKPTR(snap);
 
-    uint8_t data[2] = {0x69, 0x7A};
+    if (handle->acq_state == MC1081_ACQ_IDLE)
+        return MC1081_ERR;
 
-    return WriteByte(handle, data, 2);
-}
+    const bool periodic = (handle->acq_state == MC1081_ACQ_PERIODIC);
 
+    // 单次转换靠 STATUS 确认完成, 计划中必须包含它
+    if (plan != NULL && !periodic && !(plan->need & (1UL << MC1081_REG_STATUS)))
+        return MC1081_PARAM_ERR;
 
-MC1081_Status_t MC1081_ActiveShieldSet(MC1081_Handle_t handle,MC1081_ActiveShielCfg cfg)
-{
-    MC1081_CHECKPTR(handle);
+    handle->acq_state = MC1081_ACQ_IDLE;
 
-    MC1081_SHLD_CFG_t shld_cfg = {0};
-    shld_cfg.bits.CS = cfg.sel;
-    shld_cfg.bits.SHLD_EN = cfg.en;
-    shld_cfg.bits.SHLD_HP = cfg.pwr;
+    const uint64_t start_ns = handle->acq_start_ns;
+    uint64_t busy_ns = start_ns;
+    uint64_t request_ns = start_ns;
+    uint32_t backoff_us = (handle->acq_wait_us / 4U) + 50U;
+    MC1081_Status_t sta = MC1081_OK;
 
-    uint8_t data[2] = {0x26,0x00};
-    data[1] = shld_cfg.byte;
+    for (uint8_t retry = 0;; retry++)
+    {
+        request_ns = ClockNow(handle);
+        sta = (plan != NULL) ? ReadPlanned(handle, plan, snap) : ReadResultBlock(handle, snap); // 包含 STATUS, 即一次确认读
+        MC1081_CHECKERR(sta);
 
-    return WriteByte(handle,data,2);
-}
+        if (periodic || !(snap->isCapConverting || (handle->acq_temp && snap->isTempConverting)))
+            break;
 
-MC1081_Status_t MC1081_ActiveShieldGet(MC1081_Handle_t handle,MC1081_ActiveShielCfg *cfg)
-{
-    MC1081_CHECKPTR(handle);
-    MC1081_CHECKPTR(cfg);
+        if (retry >= MC1081_ACQ_MAX_RETRY)
+        {
+            MC1081_STAT_ADD(handle, busy_err, 1);
+            return MC1081_BUSY_ERR;
+        }
 
-    MC1081_SHLD_CFG_t shld_cfg = {0};
-    uint8_t reg_addr = 0x26;
+        MC1081_STAT_ADD(handle, busy_polls, 1);
 
-    MC1081_Status_t sta = WriteByte(handle,&reg_addr,1);
-    MC1081_CHECKERR(sta);
+        busy_ns = ClockNow(handle); // 此时仍在转换
+        handle->bus.Delay(handle->bus.ctx, backoff_us); // 预测偏短时按倍增退避
+        backoff_us *= 2U;
+    }
 
-    sta = ReadByte(handle,&shld_cfg.byte,1);
-    MC1081_CHECKERR(sta);
+    const uint64_t bus_ns = ClockNow(handle);
+    StampRead(handle, request_ns, bus_ns);
 
-    cfg->pwr = shld_cfg.bits.SHLD_HP;
-    cfg->sel = shld_cfg.bits.CS;
-    cfg->en = shld_cfg.bits.SHLD_EN;
+    if (periodic) // CCVT 一直为 1, 看不到由忙变闲; 已等到上一帧之后一个周期, 即一次转换
+        MC1081_STAT_ADD(handle, conversions, 1);
 
-    return sta;
+    if (!periodic && handle->clock != NULL)
+    {
+        // STATUS 是突发读的最后一个字节: 转换完成于最后一次看到忙之后, 本次读完之前
+        uint64_t conv_ns = start_ns + handle->period_ns;
+        if (busy_ns > start_ns)
+            conv_ns = busy_ns + (bus_ns - busy_ns) / 2U;
+        handle->time.conv_ns = (conv_ns < bus_ns) ? conv_ns : bus_ns;
+    }
+
+    return RunStages(handle, snap);
 }
 
-MC1081_Status_t MC1081_DeInit(MC1081_Handle_t *handle)
+MC1081_Status_t MC1081_AcquireWhenReady(MC1081_Handle_t handle, const MC1081_Snapshot_t *last, MC1081_Snapshot_t *snap)
 {
     MC1081_CHECKPTR(handle);
-    MC1081_CHECKPTR(*handle);
+    MC1081_CHECKPTR(snap);
 
-    free(*handle);
-    *handle = NULL;
+    uint32_t wait_us = 0;
+    MC1081_Status_t sta = MC1081_AcquireBegin(handle, last, &wait_us);
+    MC1081_CHECKERR(sta);
 
-    return MC1081_OK;
-}
+    handle->bus.Delay(handle->bus.ctx, wait_us);
 
-uint8_t MC1081_CalI2cAddr(MC1081_AddrSel_t add)
-{
-    add.bits.RSV = 0x07;
-    return add.value;
+    return MC1081_AcquireFinish(handle, NULL, snap);
 }
@@ -0,0 +1,271 @@
+#include "MC1081_conv.h"
+#include "string.h"
+
+/* 振荡器驱动电流, uA, 对应 MC1081_DriverCu_t */
+static const uint16_t s_osc_ua[] = {4, 8, 16, 42, 100, 250, 500, 1000, 2000};
+
+/* OS1 振幅, mV; 后四档为 VDD - x, 以负数表示 */
+static const int16_t s_os1_mv[] = {200, 400, 800, 1200, -2200, -1600, -1200, -800};
+
+/* OS2 振幅, mV */
+static const int16_t s_os2_mv[] = {200, 400, 800, 1200, 1600, 2000, 2400, 2400};
+
+#define MC1081_CONV_ARRAY_LEN(a) (sizeof(a) / sizeof((a)[0]))
+
+void MC1081_ConvInit(MC1081_Conv_t *conv, uint32_t fref_hz, uint16_t vdd_mv)
+{
+    if (conv == NULL)
+        return;
+
+    conv->mant = 0;
+    conv->shift = 0;
+    conv->cpar_ff = 0;
+    conv->fref_hz = (fref_hz != 0) ? fref_hz : MC1081_FREF_HZ;
+    conv->vdd_mv = (vdd_mv != 0) ? vdd_mv : MC1081_CONV_VDD_MV;
+    conv->osc_sel = MC1081_CAP_OSC_SINGLE;
+    conv->valid = 0;
+    for (uint8_t i = 0; i < sizeof(conv->key); i++)
+        conv->key[i] = 0xFF;
+}
+
+void MC1081_ConvSetParasitic(MC1081_Conv_t *conv, int32_t cpar_ff)
+{
+    if (conv != NULL)
+        conv->cpar_ff = cpar_ff;
+}
+
+/**
+ * @brief 计算每计数对应的 fF 数, 以 mant / 2^shift 表示
+ *
+ * K = I * 2^FREFDIV * 1e12 / (2 * V * N * 2^FINDIV * f_ref)   (I: uA, V: mV)
+ * 先求整数部分, 再逐位长除得到小数位, 直到尾数占满 32 位. 只在配置变化时执行.
+ */
+static MC1081_Status_t ComputeFactor(MC1081_Conv_t *conv, MC1081_ClockCfg_t clk, uint8_t fin_cycle, uint8_t cu, int32_t osc_mv)
+{
+    if (cu >= MC1081_CONV_ARRAY_LEN(s_osc_ua) || osc_mv <= 0 || clk.fin_div > MC1081_FINDIV_64 || clk.fref_div > MC1081_FREFDIV_8)
+        return MC1081_PARAM_ERR;
+
+    const uint32_t n = (fin_cycle != 0) ? fin_cycle : 1U; // 与芯片一致, N = 0 按 1 处理
+    const uint64_t num = (uint64_t)s_osc_ua[cu] * (1000000000000ULL << clk.fref_div);
+    const uint64_t den = 2ULL * (uint64_t)osc_mv * n * (1ULL << clk.fin_div) * conv->fref_hz;
+
+    uint64_t q = num / den;
+    uint64_t r = num % den;
+    uint8_t shift = 0;
+
+    if (q > UINT32_MAX)
+    {
+        q = UINT32_MAX; // 结果必然饱和
+    }
+    else
+    {
+        while (q < 0x80000000ULL && shift < 62)
+        {
+            r <<= 1;
+            q <<= 1;
+            if (r >= den)
+            {
+                r -= den;
+                q |= 1;
+            }
+            shift++;
+        }
+    }
+
+    conv->mant = (uint32_t)q;
+    conv->shift = shift;
+    conv->valid = 1;
+
+    return MC1081_OK;
+}
+
+MC1081_Status_t MC1081_ConvSetupSingle(MC1081_Conv_t *conv, MC1081_ClockCfg_t clk, uint8_t fin_cycle, MC1081_SingleOSCCfg_t osc)
+{
+    if (conv == NULL || (unsigned)osc.amplitude >= MC1081_CONV_ARRAY_LEN(s_os1_mv))
+        return MC1081_PARAM_ERR;
+
+    int32_t mv = s_os1_mv[osc.amplitude];
+    if (mv < 0)
+        mv += conv->vdd_mv;
+
+    conv->osc_sel = MC1081_CAP_OSC_SINGLE;
+    return ComputeFactor(conv, clk, fin_cycle, (uint8_t)osc.dr_cu, mv);
+}
+
+MC1081_Status_t MC1081_ConvSetupDiff(MC1081_Conv_t *conv, MC1081_ClockCfg_t clk, uint8_t fin_cycle, MC1081_DiffOSCCfg_t osc)
+{
+    if (conv == NULL || (unsigned)osc.amplitude >= MC1081_CONV_ARRAY_LEN(s_os2_mv))
+        return MC1081_PARAM_ERR;
+
+    conv->osc_sel = MC1081_CAP_OSC_DIFF;
+    return ComputeFactor(conv, clk, fin_cycle, (uint8_t)osc.dr_cu, s_os2_mv[osc.amplitude]);
+}
+
+MC1081_Status_t MC1081_ConvSync(MC1081_Handle_t handle, MC1081_Conv_t *conv)
+{
+    if (handle == NULL || conv == NULL)
+        return MC1081_PARAM_ERR;
+
+    MC1081_CapConvConfig_t cap = {0};
+    MC1081_ClockCfg_t clk = {0};
+    uint8_t fin_cycle = 0;
+    MC1081_SingleOSCCfg_t os1 = {0};
+    MC1081_DiffOSCCfg_t os2 = {0};
+
+    // 均由影子寄存器提供
+    MC1081_Status_t sta = MC1081_CapMeasureGet(handle, &cap);
+    if (sta != MC1081_OK)
+        return sta;
+    sta = MC1081_GetClockConfig(handle, &clk);
+    if (sta != MC1081_OK)
+        return sta;
+    sta = MC1081_GetFinCycle(handle, &fin_cycle);
+    if (sta != MC1081_OK)
+        return sta;
+
+    const bool diff = (cap.osc_mode == MC1081_CAP_OSC_DIFF);
+    uint8_t cu = 0;
+    uint8_t amp = 0;
+
+    if (diff)
+    {
+        sta = MC1081_DiffOSCGet(handle, &os2);
+        cu = (uint8_t)os2.dr_cu;
+        amp = (uint8_t)os2.amplitude;
+    }
+    else
+    {
+        sta = MC1081_SingleOSCGet(handle, &os1);
+        cu = (uint8_t)os1.dr_cu;
+        amp = (uint8_t)os1.amplitude;
+    }
+    if (sta != MC1081_OK)
+        return sta;
+
+    const uint8_t key[sizeof(conv->key)] = {(uint8_t)cap.osc_mode, (uint8_t)clk.fin_div, (uint8_t)clk.fref_div, fin_cycle, cu, amp};
+
+    if (conv->valid && conv->fref_hz == handle->fref_hz && memcmp(key, conv->key, sizeof(key)) == 0)
+        return MC1081_OK; // 配置未变, 沿用已有系数
+
+    conv->fref_hz = handle->fref_hz;
+    conv->valid = 0;
+    sta = diff ? MC1081_ConvSetupDiff(conv, clk, fin_cycle, os2) : MC1081_ConvSetupSingle(conv, clk, fin_cycle, os1);
+    if (sta != MC1081_OK)
+        return sta;
+
+    memcpy(conv->key, key, sizeof(key));
+    return sta;
+}
+
+void MC1081_ConvBatch(const MC1081_Conv_t *conv, const uint16_t *raw, int32_t *ff, size_t n)
+{
+    for (size_t i = 0; i < n; i++)
+    {
+        ff[i] = MC1081_ConvToFf(conv, raw[i]);
+    }
+}
+
+MC1081_Status_t MC1081_ConvFrame(const MC1081_Conv_t *conv, const MC1081_Snapshot_t *snap, MC1081_CapFrame_t *out)
+{
+    if (conv == NULL || snap == NULL || out == NULL)
+        return MC1081_PARAM_ERR;
+
+    if (!conv->valid)
+        return MC1081_ERR;
+
+    MC1081_ConvBatch(conv, snap->ch, out->ch, MC1081_CH_NUM);
+    MC1081_ConvBatch(conv, snap->mch, out->mch, MC1081_MCH_NUM);
+
+    // 溢出标志: 单端模式 OSC1 位 0 ~ 10 为通道, 11 ~ 15 为互电容; 差分模式 OSC2 位 0 ~ 5
+    if (conv->osc_sel == MC1081_CAP_OSC_DIFF)
+    {
+        for (uint8_t i = 0; i <= MC1081_DCH_DIFF_REF; i++)
+        {
+            if (snap->of_diff & (1U << i))
+                out->ch[i] = MC1081_CONV_OVERFLOW;
+        }
+    }
+    else if (snap->of_single != 0)
+    {
+        for (uint8_t i = 0; i < MC1081_CH_NUM; i++)
+        {
+            if (snap->of_single & (1U << i))
+                out->ch[i] = MC1081_CONV_OVERFLOW;
+        }
+        for (uint8_t i = 0; i < MC1081_MCH_NUM; i++)
+        {
+            if (snap->of_single & (1U << (MC1081_CH_NUM + i)))
+                out->mch[i] = MC1081_CONV_OVERFLOW;
+        }
+    }
+
+    return MC1081_OK;
+}
+
+void MC1081_TempCalInit(MC1081_TempCal_t *cal)
+{
+    if (cal == NULL)
+        return;
+
+    cal->gain_q16 = 65536;
+    cal->offset_mc = MC1081_TEMP_ZERO_MC;
+}
+
+/**
+ * @brief (int16_t)raw * gain * 1000 / 2^24, 四舍五入
+ */
+static int32_t TempSlopeMc(int32_t gain_q16, uint16_t raw)
+{
+    const int64_t v = (int64_t)(int16_t)raw * gain_q16 * 1000;
+    const int64_t half = 1LL << 23;
+
+    return (int32_t)(((v >= 0) ? (v + half) : (v - half)) / (1LL << 24));
+}
+
+MC1081_Status_t MC1081_TempCalOnePoint(MC1081_TempCal_t *cal, uint16_t raw, int32_t t_mc)
+{
+    if (cal == NULL)
+        return MC1081_PARAM_ERR;
+
+    cal->offset_mc = t_mc - TempSlopeMc(cal->gain_q16, raw);
+    return MC1081_OK;
+}
+
+MC1081_Status_t MC1081_TempCalTwoPoint(MC1081_TempCal_t *cal, uint16_t raw_a, int32_t t_a_mc, uint16_t raw_b, int32_t t_b_mc)
+{
+    if (cal == NULL || raw_a == raw_b)
+        return MC1081_PARAM_ERR;
+
+    // 标称斜率为 1000 / 256 m°C / LSB
+    const int64_t dt = (int64_t)t_b_mc - t_a_mc;
+    const int64_t draw = (int64_t)(int16_t)raw_b - (int16_t)raw_a;
+    const int64_t gain = (dt * 256 * 65536) / (draw * 1000);
+
+    if (gain <= 0 || gain > INT32_MAX)
+        return MC1081_PARAM_ERR;
+
+    cal->gain_q16 = (int32_t)gain;
+    return MC1081_TempCalOnePoint(cal, raw_a, t_a_mc);
+}
+
+int32_t MC1081_TempToMilliC(const MC1081_TempCal_t *cal, uint16_t raw)
+{
+    if (cal == NULL)
+        return MC1081_TEMP_ZERO_MC + TempSlopeMc(65536, raw);
+
+    return cal->offset_mc + TempSlopeMc(cal->gain_q16, raw);
+}
+
+MC1081_Status_t MC1081_GetTempMilliC(MC1081_Handle_t handle, const MC1081_TempCal_t *cal, int32_t *t_mc)
+{
+    if (handle == NULL || t_mc == NULL)
+        return MC1081_PARAM_ERR;
+
+    uint16_t raw = 0;
+    MC1081_Status_t sta = MC1081_GetTempRaw(handle, &raw);
+    if (sta != MC1081_OK)
+        return sta;
+
+    *t_mc = MC1081_TempToMilliC(cal, raw);
+    return sta;
+}
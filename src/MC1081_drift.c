@@ -0,0 +1,134 @@
+#include "MC1081_drift.h"
+
+#define MC1081_DRIFT_SAT (0xFFFFU)
+
+MC1081_Status_t MC1081_DriftInit(MC1081_Drift_t *drift, uint8_t ref_ch, const MC1081_TempCal_t *cal)
+{
+    if (drift == NULL || ref_ch >= MC1081_CH_NUM)
+        return MC1081_PARAM_ERR;
+
+    drift->cal = cal;
+    drift->ref_ch = ref_ch;
+    drift->learn = 1;
+    drift->alpha_ppm = 0;
+    drift->alpha_valid = 0;
+
+    for (uint8_t i = 0; i < MC1081_CH_NUM; i++)
+        drift->ch_scale_q16[i] = 65536;
+    for (uint8_t i = 0; i < MC1081_MCH_NUM; i++)
+        drift->mch_scale_q16[i] = 65536;
+
+    MC1081_DriftReset(drift);
+    return MC1081_OK;
+}
+
+void MC1081_DriftSetOrigin(MC1081_Drift_t *drift, int32_t t0_mc, uint16_t ref0)
+{
+    drift->t0_mc = t0_mc;
+    drift->ref0 = ref0;
+    drift->has_origin = 1;
+    drift->sxx = 0;
+    drift->sxy = 0;
+}
+
+void MC1081_DriftSetAlpha(MC1081_Drift_t *drift, int32_t alpha_ppm)
+{
+    drift->alpha_ppm = alpha_ppm;
+    drift->alpha_valid = 1;
+    drift->learn = 0;
+}
+
+void MC1081_DriftReset(MC1081_Drift_t *drift)
+{
+    drift->has_origin = 0;
+    drift->t0_mc = 0;
+    drift->ref0 = 0;
+    drift->sxx = 0;
+    drift->sxy = 0;
+    if (drift->learn)
+        drift->alpha_valid = 0;
+}
+
+/**
+ * @brief 用参比通道更新 alpha_ref 的加权最小二乘估计 (过原点)
+ *
+ * x = T - T0 (m°C), y = (ref - ref0) / ref0 (ppm), alpha = Sxy / Sxx * 1000 (ppm/°C).
+ * 旧样本权重每帧乘以 1 - 2^-k.
+ */
+static void Learn(MC1081_Drift_t *drift, int32_t dt_mc, uint16_t ref)
+{
+    if (ref == 0 || ref == MC1081_DRIFT_SAT || drift->ref0 == 0 || drift->ref0 == MC1081_DRIFT_SAT)
+        return;
+
+    const int64_t y_ppm = (((int64_t)ref - (int64_t)drift->ref0) * 1000000) / (int64_t)drift->ref0;
+    const int64_t div = 1LL << MC1081_DRIFT_DECAY_SHIFT;
+
+    drift->sxx += (int64_t)dt_mc * dt_mc - drift->sxx / div;
+    drift->sxy += (int64_t)dt_mc * y_ppm - drift->sxy / div;
+
+    // 温度变化不够大时斜率不可信, 保持原值
+    const int64_t min_sxx = (int64_t)MC1081_DRIFT_MIN_SPAN_MC * MC1081_DRIFT_MIN_SPAN_MC * div;
+    if (drift->sxx >= min_sxx)
+    {
+        drift->alpha_ppm = (int32_t)((drift->sxy * 1000) / drift->sxx);
+        drift->alpha_valid = 1;
+    }
+}
+
+/**
+ * @brief count * 1e9 / (1e9 + alpha * scale * dT), alpha * dT 的单位为 1e-9
+ */
+static uint16_t Compensate(uint16_t count, int64_t alpha_dt, int32_t scale_q16)
+{
+    if (count == MC1081_DRIFT_SAT)
+        return count;
+
+    const int64_t den = 1000000000LL + ((alpha_dt * scale_q16) / 65536);
+    if (den <= 0)
+        return count;
+
+    const int64_t c = (((int64_t)count * 1000000000LL) + (den / 2)) / den;
+    return (c >= MC1081_DRIFT_SAT) ? (uint16_t)(MC1081_DRIFT_SAT - 1) : (uint16_t)c;
+}
+
+bool MC1081_DriftStage(void *ctx, MC1081_Snapshot_t *snap)
+{
+    MC1081_Drift_t *drift = (MC1081_Drift_t *)ctx;
+
+    const int32_t t_mc = MC1081_TempToMilliC(drift->cal, snap->temp);
+    const uint16_t ref = snap->ch[drift->ref_ch];
+
+    if (!drift->has_origin)
+    {
+        // 参考通道为 0 或饱和时不能作原点, 等到有效帧再定, 在此之前不补偿
+        if (ref != 0 && ref != MC1081_DRIFT_SAT)
+            MC1081_DriftSetOrigin(drift, t_mc, ref);
+        return true; // 原点帧本身无需补偿
+    }
+
+    const int32_t dt_mc = t_mc - drift->t0_mc;
+
+    if (drift->learn)
+        Learn(drift, dt_mc, ref);
+
+    if (!drift->alpha_valid || dt_mc == 0)
+        return true;
+
+    const int64_t alpha_dt = (int64_t)drift->alpha_ppm * dt_mc; // ppm * m°C = 1e-9
+
+    for (uint8_t i = 0; i < MC1081_CH_NUM; i++)
+        snap->ch[i] = Compensate(snap->ch[i], alpha_dt, drift->ch_scale_q16[i]);
+
+    for (uint8_t i = 0; i < MC1081_MCH_NUM; i++)
+        snap->mch[i] = Compensate(snap->mch[i], alpha_dt, drift->mch_scale_q16[i]);
+
+    return true;
+}
+
+MC1081_Status_t MC1081_DriftAttach(MC1081_Handle_t handle, MC1081_Drift_t *drift)
+{
+    if (handle == NULL || drift == NULL)
+        return MC1081_PARAM_ERR;
+
+    return MC1081_StageAttach(handle, &drift->stage, MC1081_DriftStage, drift);
+}
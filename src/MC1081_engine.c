@@ -0,0 +1,442 @@
+#include "MC1081_engine.h"
+
+#if MC1081_HAS_ENGINE
+
+#include "string.h"
+
+/**
+ * @brief 等待第 k 轮的槽位空出, 停止时返回 NULL
+ */
+static MC1081_EngineFrame_t *WaitSlot(MC1081_Engine_t *eng, uint32_t k)
+{
+    MC1081_EngineFrame_t *slot = &eng->slot[k % eng->cfg.depth];
+
+    pthread_mutex_lock(&eng->lock);
+    while (!eng->stop && slot->round != k)
+        pthread_cond_wait(&eng->cond, &eng->lock);
+    const bool stop = eng->stop;
+    pthread_mutex_unlock(&eng->lock);
+
+    return stop ? NULL : slot;
+}
+
+/**
+ * @brief 取走设备一帧的结果, 更新吞吐统计 (持锁调用)
+ */
+static void DevAccount(MC1081_EngineDev_t *d, MC1081_Status_t sta, const MC1081_Frame_t *frame)
+{
+    MC1081_EngineDevStats_t *s = &d->stats;
+
+    if (sta == MC1081_DROP_ERR)
+    {
+        s->drops++;
+        return;
+    }
+    if (sta != MC1081_OK)
+    {
+        s->errors++;
+        return;
+    }
+
+    if (s->frames == 0)
+        s->first_ns = frame->time.bus_ns;
+    s->last_ns = frame->time.bus_ns;
+    s->read_ns += frame->time.bus_ns - frame->time.request_ns;
+    s->frames++;
+
+    // 速率取首末帧之间, 单位 mHz; 以 us 计时避免溢出
+    const uint64_t span_us = (s->last_ns - s->first_ns) / 1000U;
+    if (span_us > 0)
+    {
+        s->rate_mhz = (uint32_t)(((uint64_t)(s->frames - 1U) * 1000000000ULL) / span_us);
+        const uint64_t pct = (s->read_ns / 10U) / span_us;
+        s->bus_pct = (uint16_t)((pct > 100U) ? 100U : pct);
+    }
+}
+
+/**
+ * @brief 一组设备中成功帧的转换结束时刻之差, 返回成功帧数
+ */
+static uint8_t Spread(const MC1081_EngineFrame_t *slot, const uint8_t *dev, uint8_t num, uint64_t *skew_ns)
+{
+    uint64_t lo = UINT64_MAX;
+    uint64_t hi = 0;
+    uint8_t good = 0;
+
+    for (uint8_t i = 0; i < num; i++)
+    {
+        const uint8_t d = (dev != NULL) ? dev[i] : i;
+        if (slot->sta[d] != MC1081_OK)
+            continue;
+        const uint64_t t = slot->frame[d].time.conv_ns;
+        lo = (t < lo) ? t : lo;
+        hi = (t > hi) ? t : hi;
+        good++;
+    }
+
+    *skew_ns = (good > 1) ? (hi - lo) : 0;
+    return good;
+}
+
+/**
+ * @brief 本总线的设备已完成第 k 轮; 最后一个完成的总线负责交付整轮并释放槽位
+ */
+static void Post(MC1081_Engine_t *eng, MC1081_EngineBus_t *bus, MC1081_EngineFrame_t *slot)
+{
+    const uint8_t idx = (uint8_t)(slot - eng->slot);
+    uint64_t bus_skew_ns = 0;
+
+    Spread(slot, bus->dev, bus->num, &bus_skew_ns);
+
+    pthread_mutex_lock(&eng->lock);
+
+    for (uint8_t i = 0; i < bus->num; i++)
+    {
+        const uint8_t d = bus->dev[i];
+        DevAccount(&eng->dev[d], slot->sta[d], &slot->frame[d]);
+    }
+
+    if (eng->posted[idx] == 0 || bus_skew_ns > slot->bus_skew_ns)
+        slot->bus_skew_ns = bus_skew_ns;
+
+    eng->posted[idx] = (uint8_t)(eng->posted[idx] + bus->num);
+    if (eng->posted[idx] < eng->num)
+    {
+        pthread_mutex_unlock(&eng->lock);
+        return;
+    }
+
+    pthread_mutex_unlock(&eng->lock);
+
+    // 各设备只写自己的下标, 此时整轮已齐, 其余线程不会再碰这个槽位
+    slot->num = eng->num;
+    slot->good = Spread(slot, NULL, eng->num, &slot->skew_ns);
+
+    if (eng->cfg.on_frame != NULL)
+        eng->cfg.on_frame(eng->cfg.user, slot);
+
+    pthread_mutex_lock(&eng->lock);
+    if (slot->skew_ns > eng->skew_max_ns)
+        eng->skew_max_ns = slot->skew_ns;
+    if (slot->bus_skew_ns > eng->bus_skew_ns)
+        eng->bus_skew_ns = slot->bus_skew_ns;
+    eng->rounds++;
+    eng->posted[idx] = 0;
+    slot->round += eng->cfg.depth;
+    pthread_cond_broadcast(&eng->cond);
+    pthread_mutex_unlock(&eng->lock);
+}
+
+/**
+ * @brief 读完一个设备, 结果写入槽位中该设备的下标
+ */
+static void Finish(MC1081_EngineDev_t *d, MC1081_Status_t sta, MC1081_EngineFrame_t *slot, uint8_t idx)
+{
+    MC1081_Frame_t *frame = &slot->frame[idx];
+
+    if (sta == MC1081_OK)
+        sta = MC1081_AcquireFinish(d->handle, d->plan, &frame->data);
+
+    if (sta == MC1081_OK || sta == MC1081_DROP_ERR)
+    {
+        MC1081_LastFrameTime(d->handle, &frame->time);
+        frame->timestamp = frame->time.bus_ns;
+    }
+    if (sta == MC1081_OK)
+    {
+        d->last = frame->data;
+        d->has_last = 1;
+    }
+
+    slot->sta[idx] = sta;
+}
+
+/**
+ * @brief 休眠到 ready_ns (总线时钟)
+ */
+static void SleepUntil(MC1081_EngineBus_t *bus, uint64_t ready_ns)
+{
+    const uint64_t now = bus->clock(bus->clock_ctx);
+
+    if (ready_ns > now)
+        bus->bus.Delay(bus->bus.ctx, (uint32_t)((ready_ns - now + 999U) / 1000U));
+}
+
+/**
+ * @brief 一条总线的一轮: 先启动全部设备, 再按转换结束的先后依次读取
+ */
+static void RunRound(MC1081_Engine_t *eng, MC1081_EngineBus_t *bus, MC1081_EngineFrame_t *slot)
+{
+    MC1081_Status_t sta[MC1081_ENGINE_MAX_DEV];
+    uint8_t order[MC1081_ENGINE_MAX_DEV];
+
+    if (eng->cfg.budget_us != 0)
+    {
+        const uint64_t deadline_ns = bus->clock(bus->clock_ctx) + (uint64_t)eng->cfg.budget_us * 1000ULL;
+        for (uint8_t i = 0; i < bus->num; i++)
+            MC1081_SetDeadline(eng->dev[bus->dev[i]].handle, deadline_ns);
+    }
+
+    for (uint8_t i = 0; i < bus->num; i++)
+    {
+        MC1081_EngineDev_t *d = &eng->dev[bus->dev[i]];
+        uint32_t wait_us = 0;
+
+        sta[i] = MC1081_AcquireBegin(d->handle, d->has_last ? &d->last : NULL, &wait_us);
+        d->ready_ns = bus->clock(bus->clock_ctx) + (uint64_t)wait_us * 1000ULL;
+
+        if (eng->cfg.serial) // 对照: 启动后立即等待并读取, 不与其他设备重叠
+        {
+            if (sta[i] == MC1081_OK)
+                SleepUntil(bus, d->ready_ns);
+            Finish(d, sta[i], slot, bus->dev[i]);
+            continue;
+        }
+
+        // 按就绪时刻插入排序, 每条总线的设备数很少
+        uint8_t j = i;
+        while (j > 0 && eng->dev[bus->dev[order[j - 1]]].ready_ns > d->ready_ns)
+        {
+            order[j] = order[j - 1];
+            j--;
+        }
+        order[j] = i;
+    }
+
+    if (eng->cfg.serial)
+        return;
+
+    for (uint8_t n = 0; n < bus->num; n++)
+    {
+        const uint8_t i = order[n];
+        MC1081_EngineDev_t *d = &eng->dev[bus->dev[i]];
+
+        if (sta[i] == MC1081_OK)
+            SleepUntil(bus, d->ready_ns);
+        Finish(d, sta[i], slot, bus->dev[i]);
+    }
+}
+
+/**
+ * @brief 总线工作线程
+ */
+static void *Worker(void *arg)
+{
+    MC1081_EngineBus_t *bus = (MC1081_EngineBus_t *)arg;
+    MC1081_Engine_t *eng = bus->eng;
+
+    for (uint32_t k = 0; eng->cfg.rounds == 0 || k < eng->cfg.rounds; k++)
+    {
+        MC1081_EngineFrame_t *slot = WaitSlot(eng, k);
+        if (slot == NULL)
+            break;
+
+        RunRound(eng, bus, slot);
+        Post(eng, bus, slot);
+    }
+
+    if (eng->cfg.budget_us != 0)
+    {
+        for (uint8_t i = 0; i < bus->num; i++)
+            MC1081_SetDeadline(eng->dev[bus->dev[i]].handle, 0);
+    }
+
+    return NULL;
+}
+
+MC1081_Status_t MC1081_EngineInit(MC1081_Engine_t *eng, const MC1081_EngineCfg_t *cfg)
+{
+    if (eng == NULL || cfg == NULL)
+        return MC1081_PARAM_ERR;
+
+    if (cfg->depth > MC1081_ENGINE_DEPTH)
+        return MC1081_PARAM_ERR;
+
+    memset(eng, 0, sizeof(MC1081_Engine_t));
+    eng->cfg = *cfg;
+    if (eng->cfg.depth == 0)
+        eng->cfg.depth = 1;
+
+    if (pthread_mutex_init(&eng->lock, NULL) != 0)
+        return MC1081_ERR;
+    if (pthread_cond_init(&eng->cond, NULL) != 0)
+    {
+        pthread_mutex_destroy(&eng->lock);
+        return MC1081_ERR;
+    }
+
+    return MC1081_OK;
+}
+
+MC1081_Status_t MC1081_EngineAddBus(MC1081_Engine_t *eng, const MC1081_Bus_t *bus, MC1081_ClockFunc_t clock,
+                                    void *clock_ctx, uint8_t *id)
+{
+    if (eng == NULL || bus == NULL || bus->Delay == NULL || clock == NULL)
+        return MC1081_PARAM_ERR;
+
+    if (eng->running)
+        return MC1081_BUSY_ERR;
+
+    if (eng->bus_num >= MC1081_ENGINE_MAX_BUS)
+        return MC1081_PARAM_ERR;
+
+    MC1081_EngineBus_t *b = &eng->bus[eng->bus_num];
+    memset(b, 0, sizeof(MC1081_EngineBus_t));
+    b->eng = eng;
+    b->bus = *bus;
+    b->clock = clock;
+    b->clock_ctx = clock_ctx;
+
+    if (id != NULL)
+        *id = eng->bus_num;
+    eng->bus_num++;
+
+    return MC1081_OK;
+}
+
+MC1081_Status_t MC1081_EngineAddDevice(MC1081_Engine_t *eng, uint8_t bus, MC1081_Handle_t handle,
+                                       const MC1081_ScanPlan_t *plan, uint8_t *id)
+{
+    if (eng == NULL || handle == NULL)
+        return MC1081_PARAM_ERR;
+
+    if (eng->running)
+        return MC1081_BUSY_ERR;
+
+    if (bus >= eng->bus_num || eng->num >= MC1081_ENGINE_MAX_DEV)
+        return MC1081_PARAM_ERR;
+
+    MC1081_EngineBus_t *b = &eng->bus[bus];
+    MC1081_Status_t sta = MC1081_SetClock(handle, b->clock, b->clock_ctx);
+    if (sta != MC1081_OK)
+        return sta;
+
+    MC1081_EngineDev_t *d = &eng->dev[eng->num];
+    memset(d, 0, sizeof(MC1081_EngineDev_t));
+    d->handle = handle;
+    d->plan = plan;
+    d->bus = bus;
+
+    b->dev[b->num++] = eng->num;
+
+    if (id != NULL)
+        *id = eng->num;
+    eng->num++;
+
+    return MC1081_OK;
+}
+
+MC1081_Status_t MC1081_EngineStart(MC1081_Engine_t *eng)
+{
+    if (eng == NULL)
+        return MC1081_PARAM_ERR;
+
+    if (eng->running)
+        return MC1081_BUSY_ERR;
+
+    if (eng->num == 0)
+        return MC1081_PARAM_ERR;
+
+    for (uint8_t i = 0; i < eng->cfg.depth; i++)
+    {
+        eng->slot[i].round = i;
+        eng->posted[i] = 0;
+    }
+    eng->stop = 0;
+    eng->running = 1;
+
+    for (uint8_t i = 0; i < eng->bus_num; i++)
+    {
+        MC1081_EngineBus_t *b = &eng->bus[i];
+        if (b->num == 0)
+            continue;
+
+        if (pthread_create(&b->thread, NULL, Worker, b) != 0)
+        {
+            MC1081_EngineStop(eng);
+            return MC1081_ERR;
+        }
+        b->running = 1;
+    }
+
+    return MC1081_OK;
+}
+
+MC1081_Status_t MC1081_EngineWait(MC1081_Engine_t *eng)
+{
+    if (eng == NULL)
+        return MC1081_PARAM_ERR;
+
+    for (uint8_t i = 0; i < eng->bus_num; i++)
+    {
+        MC1081_EngineBus_t *b = &eng->bus[i];
+        if (b->running)
+        {
+            pthread_join(b->thread, NULL);
+            b->running = 0;
+        }
+    }
+    eng->running = 0;
+
+    return MC1081_OK;
+}
+
+MC1081_Status_t MC1081_EngineStop(MC1081_Engine_t *eng)
+{
+    if (eng == NULL)
+        return MC1081_PARAM_ERR;
+
+    pthread_mutex_lock(&eng->lock);
+    eng->stop = 1;
+    pthread_cond_broadcast(&eng->cond);
+    pthread_mutex_unlock(&eng->lock);
+
+    return MC1081_EngineWait(eng);
+}
+
+void MC1081_EngineDeInit(MC1081_Engine_t *eng)
+{
+    if (eng == NULL)
+        return;
+
+    MC1081_EngineStop(eng);
+    pthread_cond_destroy(&eng->cond);
+    pthread_mutex_destroy(&eng->lock);
+}
+
+MC1081_Status_t MC1081_EngineDevStats(MC1081_Engine_t *eng, uint8_t dev, MC1081_EngineDevStats_t *stats)
+{
+    if (eng == NULL || stats == NULL || dev >= eng->num)
+        return MC1081_PARAM_ERR;
+
+    pthread_mutex_lock(&eng->lock);
+    *stats = eng->dev[dev].stats;
+    pthread_mutex_unlock(&eng->lock);
+
+    return MC1081_OK;
+}
+
+MC1081_Status_t MC1081_EngineStats(MC1081_Engine_t *eng, MC1081_EngineStats_t *stats)
+{
+    if (eng == NULL || stats == NULL)
+        return MC1081_PARAM_ERR;
+
+    memset(stats, 0, sizeof(MC1081_EngineStats_t));
+
+    pthread_mutex_lock(&eng->lock);
+    stats->rounds = eng->rounds;
+    stats->skew_max_ns = eng->skew_max_ns;
+    stats->bus_skew_ns = eng->bus_skew_ns;
+    for (uint8_t d = 0; d < eng->num; d++)
+    {
+        const MC1081_EngineDevStats_t *s = &eng->dev[d].stats;
+        stats->frames += s->frames;
+        stats->errors += s->errors;
+        stats->rate_mhz += s->rate_mhz;
+    }
+    pthread_mutex_unlock(&eng->lock);
+
+    return MC1081_OK;
+}
+
+#endif
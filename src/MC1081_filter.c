@@ -0,0 +1,183 @@
+#include "MC1081_filter.h"
+#include "string.h"
+
+#define MC1081_FILTER_SAT (0xFFFFU)
+
+void MC1081_FilterInit(MC1081_Filter_t *filter)
+{
+    if (filter == NULL)
+        return;
+
+    memset(filter, 0, sizeof(MC1081_Filter_t));
+}
+
+void MC1081_FilterReset(MC1081_Filter_t *filter)
+{
+    filter->primed = 0;
+    filter->med_pos = 0;
+    filter->box_pos = 0;
+    filter->decim_cnt = 0;
+}
+
+MC1081_Status_t MC1081_FilterSetMedian(MC1081_Filter_t *filter, uint16_t lanes, uint8_t n)
+{
+    if (filter == NULL || n > MC1081_FILTER_MAX_MEDIAN || (n > 1 && (n & 1U) == 0))
+        return MC1081_PARAM_ERR;
+
+    filter->med_n = (n > 1) ? n : 0;
+    filter->med_lanes = (n > 1) ? lanes : 0;
+    MC1081_FilterReset(filter);
+
+    return MC1081_OK;
+}
+
+MC1081_Status_t MC1081_FilterSetBoxcar(MC1081_Filter_t *filter, uint16_t lanes, uint8_t n)
+{
+    if (filter == NULL || n > MC1081_FILTER_MAX_BOXCAR)
+        return MC1081_PARAM_ERR;
+
+    filter->box_n = (n > 1) ? n : 0;
+    filter->box_lanes = (n > 1) ? lanes : 0;
+    filter->box_recip = (n > 1) ? (uint32_t)((1ULL << 32) / n) : 0;
+    MC1081_FilterReset(filter);
+
+    return MC1081_OK;
+}
+
+MC1081_Status_t MC1081_FilterSetIir(MC1081_Filter_t *filter, uint16_t lanes, uint8_t shift)
+{
+    if (filter == NULL || shift > 15)
+        return MC1081_PARAM_ERR;
+
+    for (uint8_t l = 0; l < MC1081_FILTER_LANES; l++)
+    {
+        if (lanes & (1U << l))
+            filter->iir_shift[l] = shift;
+    }
+
+    return MC1081_OK;
+}
+
+void MC1081_FilterSetDecimation(MC1081_Filter_t *filter, uint8_t m)
+{
+    filter->decim = (m > 1) ? m : 0;
+    filter->decim_cnt = 0;
+}
+
+uint32_t MC1081_FilterOutQ16(const MC1081_Filter_t *filter, uint8_t lane)
+{
+    return (lane < MC1081_FILTER_LANES) ? filter->out_q16[lane] : 0;
+}
+
+/**
+ * @brief 首个样本填满该通道的所有窗口, 使输出从第一帧起即为稳态
+ */
+static void Prime(MC1081_Filter_t *filter, uint8_t l, uint16_t x)
+{
+    for (uint8_t t = 0; t < MC1081_FILTER_MAX_MEDIAN; t++)
+        filter->med_hist[t][l] = x;
+
+    for (uint8_t t = 0; t < MC1081_FILTER_MAX_BOXCAR; t++)
+        filter->box_hist[t][l] = x;
+
+    filter->box_sum[l] = (uint32_t)x * filter->box_n;
+    filter->out_q16[l] = (uint32_t)x << 16;
+    filter->primed |= (uint16_t)(1U << l);
+}
+
+/**
+ * @brief 窗口最多 MC1081_FILTER_MAX_MEDIAN 个样本, 插入排序后取中间值
+ */
+static uint16_t Median(const MC1081_Filter_t *filter, uint8_t l)
+{
+    uint16_t w[MC1081_FILTER_MAX_MEDIAN];
+
+    for (uint8_t i = 0; i < filter->med_n; i++)
+    {
+        const uint16_t v = filter->med_hist[i][l];
+        uint8_t j = i;
+        while (j > 0 && w[j - 1] > v)
+        {
+            w[j] = w[j - 1];
+            j--;
+        }
+        w[j] = v;
+    }
+
+    return w[filter->med_n / 2];
+}
+
+bool MC1081_FilterStage(void *ctx, MC1081_Snapshot_t *snap)
+{
+    MC1081_Filter_t *filter = (MC1081_Filter_t *)ctx;
+    uint16_t x[MC1081_FILTER_LANES];
+
+    memcpy(x, snap->ch, sizeof(snap->ch));
+    memcpy(&x[MC1081_CH_NUM], snap->mch, sizeof(snap->mch));
+
+    for (uint8_t l = 0; l < MC1081_FILTER_LANES; l++)
+    {
+        const uint16_t bit = (uint16_t)(1U << l);
+
+        if (x[l] == MC1081_FILTER_SAT)
+            continue; // 溢出值不进入滤波状态
+
+        if (!(filter->primed & bit))
+            Prime(filter, l, x[l]);
+
+        uint16_t v = x[l];
+
+        if (filter->med_lanes & bit)
+        {
+            filter->med_hist[filter->med_pos][l] = v;
+            v = Median(filter, l);
+        }
+
+        uint32_t y = (uint32_t)v << 16;
+
+        if (filter->box_lanes & bit)
+        {
+            filter->box_sum[l] += (uint32_t)v - filter->box_hist[filter->box_pos][l];
+            filter->box_hist[filter->box_pos][l] = v;
+            y = (uint32_t)(((uint64_t)filter->box_sum[l] * filter->box_recip) >> 16);
+        }
+
+        const uint8_t k = filter->iir_shift[l];
+        if (k != 0)
+        {
+            uint32_t s = filter->out_q16[l];
+            s = (y >= s) ? (s + ((y - s) >> k)) : (s - ((s - y) >> k));
+            y = s;
+        }
+
+        filter->out_q16[l] = y;
+        x[l] = (uint16_t)((y + 0x8000U) >> 16);
+        if (x[l] == MC1081_FILTER_SAT)
+            x[l] = MC1081_FILTER_SAT - 1;
+    }
+
+    if (filter->med_n != 0)
+        filter->med_pos = (uint8_t)((filter->med_pos + 1) % filter->med_n);
+    if (filter->box_n != 0)
+        filter->box_pos = (uint8_t)((filter->box_pos + 1) % filter->box_n);
+
+    memcpy(snap->ch, x, sizeof(snap->ch));
+    memcpy(snap->mch, &x[MC1081_CH_NUM], sizeof(snap->mch));
+
+    if (filter->decim != 0)
+    {
+        if (++filter->decim_cnt < filter->decim)
+            return false;
+        filter->decim_cnt = 0;
+    }
+
+    return true;
+}
+
+MC1081_Status_t MC1081_FilterAttach(MC1081_Handle_t handle, MC1081_Filter_t *filter)
+{
+    if (handle == NULL || filter == NULL)
+        return MC1081_PARAM_ERR;
+
+    return MC1081_StageAttach(handle, &filter->stage, MC1081_FilterStage, filter);
+}
@@ -0,0 +1,63 @@
+#include "MC1081_latency.h"
+#include "string.h"
+
+void MC1081_LatencyInit(MC1081_Latency_t *lat)
+{
+    if (lat == NULL)
+        return;
+
+    memset(lat, 0, sizeof(MC1081_Latency_t));
+}
+
+void MC1081_LatencyAdd(MC1081_Latency_t *lat, MC1081_LatPath_t path, uint64_t ns)
+{
+    if (lat == NULL || (unsigned)path >= MC1081_LAT_PATH_NUM)
+        return;
+
+    MC1081_LatHistAdd(&lat->path[path], ns);
+}
+
+/**
+ * @brief to - from, 时钟倒退时记 0
+ */
+static uint64_t Span(uint64_t from, uint64_t to)
+{
+    return (to > from) ? (to - from) : 0;
+}
+
+void MC1081_LatencyRecord(MC1081_Latency_t *lat, const MC1081_FrameTime_t *time, uint64_t consumed_ns)
+{
+    if (lat == NULL || time == NULL || time->bus_ns == 0)
+        return;
+
+    MC1081_LatencyAdd(lat, MC1081_LAT_BUS, Span(time->request_ns, time->bus_ns));
+    MC1081_LatencyAdd(lat, MC1081_LAT_CONV_TO_READ, Span(time->conv_ns, time->bus_ns));
+    MC1081_LatencyAdd(lat, MC1081_LAT_READ_TO_CONSUMER, Span(time->bus_ns, consumed_ns));
+    MC1081_LatencyAdd(lat, MC1081_LAT_END_TO_END, Span(time->conv_ns, consumed_ns));
+}
+
+uint32_t MC1081_LatencyPercentile(const MC1081_Latency_t *lat, MC1081_LatPath_t path, uint16_t permille)
+{
+    if (lat == NULL || (unsigned)path >= MC1081_LAT_PATH_NUM)
+        return 0;
+
+    return MC1081_LatHistPercentile(&lat->path[path], permille);
+}
+
+MC1081_Status_t MC1081_LatencySummary(const MC1081_Latency_t *lat, MC1081_LatPath_t path, MC1081_LatSummary_t *out)
+{
+    if (lat == NULL || out == NULL || (unsigned)path >= MC1081_LAT_PATH_NUM)
+        return MC1081_PARAM_ERR;
+
+    const MC1081_LatHist_t *h = &lat->path[path];
+
+    out->count = h->count;
+    out->min = h->min_ns;
+    out->p50 = MC1081_LatencyPercentile(lat, path, 500);
+    out->p90 = MC1081_LatencyPercentile(lat, path, 900);
+    out->p99 = MC1081_LatencyPercentile(lat, path, 990);
+    out->p999 = MC1081_LatencyPercentile(lat, path, 999);
+    out->max = h->max_ns;
+
+    return MC1081_OK;
+}
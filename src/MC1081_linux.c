@@ -0,0 +1,170 @@
+#ifdef __linux__
+
+#define _POSIX_C_SOURCE 200809L
+
+#include "MC1081_linux.h"
+#include "errno.h"
+#include "fcntl.h"
+#include "string.h"
+#include "time.h"
+#include "unistd.h"
+#include "sys/ioctl.h"
+#include "linux/i2c.h"
+#include "linux/i2c-dev.h"
+
+/**
+ * @brief 内核错误码映射为总线结果码
+ */
+static int BusCode(int err)
+{
+    switch (err)
+    {
+    case ENXIO:
+        return MC1081_BUS_ADDR_NACK;
+    case EREMOTEIO:
+        return MC1081_BUS_DATA_NACK;
+    case ETIMEDOUT:
+        return MC1081_BUS_TIMEOUT;
+    default:
+        return -1;
+    }
+}
+
+/**
+ * @brief 以一次 I2C_RDWR 发出整个消息列表 (中间为重复起始, 最后一个 STOP)
+ */
+static int Transfer(MC1081_LinuxBus_t *bus, struct i2c_msg *msgs, uint32_t num)
+{
+    bus->calls++;
+    bus->msgs += num;
+
+    if (bus->xfer != NULL)
+    {
+        const int ret = bus->xfer(bus->xfer_ctx, msgs, num);
+        return (ret < 0) ? BusCode(-ret) : MC1081_BUS_OK;
+    }
+
+    struct i2c_rdwr_ioctl_data rdwr = {msgs, num};
+    int ret = 0;
+    do
+    {
+        ret = ioctl(bus->fd, I2C_RDWR, &rdwr);
+    } while (ret < 0 && errno == EINTR);
+
+    return (ret < 0) ? BusCode(errno) : MC1081_BUS_OK;
+}
+
+MC1081_Status_t MC1081_LinuxBusOpen(MC1081_LinuxBus_t *bus, const char *path)
+{
+    if (bus == NULL || path == NULL)
+        return MC1081_PARAM_ERR;
+
+    memset(bus, 0, sizeof(MC1081_LinuxBus_t));
+    bus->fd = open(path, O_RDWR | O_CLOEXEC);
+    if (bus->fd < 0)
+        return MC1081_ERR;
+
+    // 需要适配器支持原始 I2C 消息 (I2C_RDWR), 仅支持 SMBus 的适配器不可用
+    unsigned long funcs = 0;
+    if (ioctl(bus->fd, I2C_FUNCS, &funcs) < 0 || !(funcs & I2C_FUNC_I2C))
+    {
+        MC1081_LinuxBusClose(bus);
+        return MC1081_ERR;
+    }
+
+    return MC1081_OK;
+}
+
+void MC1081_LinuxBusInitHook(MC1081_LinuxBus_t *bus, MC1081_LinuxXferFunc_t xfer, void *ctx)
+{
+    if (bus == NULL)
+        return;
+
+    memset(bus, 0, sizeof(MC1081_LinuxBus_t));
+    bus->fd = -1;
+    bus->xfer = xfer;
+    bus->xfer_ctx = ctx;
+}
+
+void MC1081_LinuxBusClose(MC1081_LinuxBus_t *bus)
+{
+    if (bus == NULL)
+        return;
+
+    if (bus->fd >= 0)
+        close(bus->fd);
+    bus->fd = -1;
+}
+
+void MC1081_LinuxBusInterface(MC1081_LinuxBus_t *bus, MC1081_Bus_t *out)
+{
+    if (out == NULL)
+        return;
+
+    memset(out, 0, sizeof(MC1081_Bus_t));
+    out->ctx = bus;
+    out->Write = MC1081_LinuxBusWrite;
+    out->Read = MC1081_LinuxBusRead;
+    out->Delay = MC1081_LinuxBusDelay;
+    out->ReadRegs = MC1081_LinuxBusReadRegs;
+}
+
+int MC1081_LinuxBusWrite(void *ctx, uint8_t addr, const uint8_t *data, size_t len)
+{
+    struct i2c_msg msg = {addr, 0, (uint16_t)len, (uint8_t *)data};
+
+    return Transfer((MC1081_LinuxBus_t *)ctx, &msg, 1);
+}
+
+int MC1081_LinuxBusRead(void *ctx, uint8_t addr, uint8_t *dst, size_t len)
+{
+    struct i2c_msg msg = {addr, I2C_M_RD, (uint16_t)len, dst};
+
+    return Transfer((MC1081_LinuxBus_t *)ctx, &msg, 1);
+}
+
+int MC1081_LinuxBusReadRegs(void *ctx, uint8_t addr, const MC1081_ScanBurst_t *burst, uint8_t num, uint8_t *dst)
+{
+    MC1081_LinuxBus_t *bus = (MC1081_LinuxBus_t *)ctx;
+    struct i2c_msg msgs[I2C_RDWR_IOCTL_MAX_MSGS];
+    uint8_t i = 0;
+
+    // 每段: 写指针 + 读数据; 超过单次 ioctl 的消息上限时分批
+    while (i < num)
+    {
+        uint32_t n = 0;
+        for (; i < num && n + 2 <= I2C_RDWR_IOCTL_MAX_MSGS; i++)
+        {
+            msgs[n++] = (struct i2c_msg){addr, 0, 1, (uint8_t *)&burst[i].reg};
+            msgs[n++] = (struct i2c_msg){addr, I2C_M_RD, burst[i].len, dst};
+            dst += burst[i].len;
+        }
+
+        const int ret = Transfer(bus, msgs, n);
+        if (ret != MC1081_BUS_OK)
+            return ret;
+    }
+
+    return MC1081_BUS_OK;
+}
+
+void MC1081_LinuxBusDelay(void *ctx, uint32_t us)
+{
+    (void)ctx;
+
+    struct timespec ts = {(time_t)(us / 1000000U), (long)(us % 1000000U) * 1000L};
+    while (nanosleep(&ts, &ts) != 0 && errno == EINTR)
+    {
+    }
+}
+
+uint64_t MC1081_LinuxBusClock(void *ctx)
+{
+    (void)ctx;
+
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ULL + (uint64_t)ts.tv_nsec;
+}
+
+#endif
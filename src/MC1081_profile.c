@@ -0,0 +1,182 @@
+#include "MC1081_profile.h"
+#include "string.h"
+
+#define MC1081_PROFILE_MAGIC0 ('M')
+#define MC1081_PROFILE_MAGIC1 ('1')
+#define MC1081_PROFILE_CRC_OFF (MC1081_PROFILE_SIZE - 2U)
+
+/**
+ * @brief CRC-16/CCITT-FALSE: 多项式 0x1021, 初值 0xFFFF
+ */
+static uint16_t Crc16(const uint8_t *data, size_t len)
+{
+    uint16_t crc = 0xFFFF;
+
+    for (size_t i = 0; i < len; i++)
+    {
+        crc ^= (uint16_t)(data[i] << 8);
+        for (uint8_t b = 0; b < 8; b++)
+            crc = (crc & 0x8000U) ? (uint16_t)((crc << 1) ^ 0x1021U) : (uint16_t)(crc << 1);
+    }
+
+    return crc;
+}
+
+static void Put16(uint8_t *p, uint16_t v)
+{
+    p[0] = (uint8_t)(v & 0xFF);
+    p[1] = (uint8_t)(v >> 8);
+}
+
+static void Put32(uint8_t *p, uint32_t v)
+{
+    Put16(p, (uint16_t)(v & 0xFFFF));
+    Put16(p + 2, (uint16_t)(v >> 16));
+}
+
+static uint16_t Get16(const uint8_t *p)
+{
+    return (uint16_t)(p[0] | (p[1] << 8));
+}
+
+static uint32_t Get32(const uint8_t *p)
+{
+    return (uint32_t)Get16(p) | ((uint32_t)Get16(p + 2) << 16);
+}
+
+MC1081_Status_t MC1081_ProfileCapture(MC1081_Handle_t handle, MC1081_Profile_t *profile, const MC1081_Conv_t *conv,
+                                      const MC1081_TempCal_t *cal, const MC1081_Drift_t *drift)
+{
+    if (handle == NULL || profile == NULL)
+        return MC1081_PARAM_ERR;
+
+    MC1081_DeviceConfig_t cfg;
+    MC1081_Status_t sta = MC1081_DeviceConfigGet(handle, &cfg);
+    if (sta != MC1081_OK)
+        return sta;
+
+    memset(profile, 0, sizeof(MC1081_Profile_t));
+    MC1081_DeviceConfigEncode(&cfg, profile->regs);
+
+    profile->fref_hz = (conv != NULL) ? conv->fref_hz : handle->fref_hz;
+    profile->vdd_mv = (conv != NULL) ? conv->vdd_mv : MC1081_CONV_VDD_MV;
+    profile->cpar_ff = (conv != NULL) ? conv->cpar_ff : 0;
+
+    if (cal != NULL)
+        profile->temp = *cal;
+    else
+        MC1081_TempCalInit(&profile->temp);
+
+    if (drift != NULL && drift->alpha_valid)
+    {
+        profile->alpha_ppm = drift->alpha_ppm;
+        profile->flags |= MC1081_PROFILE_F_ALPHA;
+    }
+
+    return MC1081_OK;
+}
+
+void MC1081_ProfileSerialize(const MC1081_Profile_t *profile, uint8_t *buf)
+{
+    buf[0] = MC1081_PROFILE_MAGIC0;
+    buf[1] = MC1081_PROFILE_MAGIC1;
+    buf[2] = MC1081_PROFILE_VERSION;
+    buf[3] = MC1081_PROFILE_SIZE;
+    memcpy(&buf[4], profile->regs, MC1081_CFG_REG_NUM);
+    buf[15] = profile->flags;
+    Put32(&buf[16], profile->fref_hz);
+    Put16(&buf[20], profile->vdd_mv);
+    Put32(&buf[22], (uint32_t)profile->cpar_ff);
+    Put32(&buf[26], (uint32_t)profile->temp.gain_q16);
+    Put32(&buf[30], (uint32_t)profile->temp.offset_mc);
+    Put32(&buf[34], (uint32_t)profile->alpha_ppm);
+    Put16(&buf[MC1081_PROFILE_CRC_OFF], Crc16(buf, MC1081_PROFILE_CRC_OFF));
+}
+
+MC1081_Status_t MC1081_ProfileParse(MC1081_Profile_t *profile, const uint8_t *buf, size_t len)
+{
+    if (profile == NULL || buf == NULL || len < MC1081_PROFILE_SIZE)
+        return MC1081_PARAM_ERR;
+
+    if (buf[0] != MC1081_PROFILE_MAGIC0 || buf[1] != MC1081_PROFILE_MAGIC1 ||
+        buf[2] != MC1081_PROFILE_VERSION || buf[3] != MC1081_PROFILE_SIZE)
+        return MC1081_PARAM_ERR;
+
+    if (Get16(&buf[MC1081_PROFILE_CRC_OFF]) != Crc16(buf, MC1081_PROFILE_CRC_OFF))
+        return MC1081_ERR;
+
+    memcpy(profile->regs, &buf[4], MC1081_CFG_REG_NUM);
+    profile->flags = buf[15];
+    profile->fref_hz = Get32(&buf[16]);
+    profile->vdd_mv = Get16(&buf[20]);
+    profile->cpar_ff = (int32_t)Get32(&buf[22]);
+    profile->temp.gain_q16 = (int32_t)Get32(&buf[26]);
+    profile->temp.offset_mc = (int32_t)Get32(&buf[30]);
+    profile->alpha_ppm = (int32_t)Get32(&buf[34]);
+
+    return MC1081_OK;
+}
+
+MC1081_Status_t MC1081_ProfileWarmStart(MC1081_Handle_t handle, const MC1081_Profile_t *profile, uint8_t *warm)
+{
+    if (handle == NULL || profile == NULL)
+        return MC1081_PARAM_ERR;
+
+    if (warm != NULL)
+        *warm = 0;
+
+    // 一次突发读回整块配置, 同时使影子寄存器有效
+    MC1081_Status_t sta = MC1081_SyncShadow(handle);
+    if (sta != MC1081_OK)
+        return sta;
+
+    MC1081_DeviceConfig_t cfg;
+    sta = MC1081_DeviceConfigGet(handle, &cfg);
+    if (sta != MC1081_OK)
+        return sta;
+
+    // 经过一次编解码, 忽略保留位的差异
+    uint8_t regs[MC1081_CFG_REG_NUM];
+    MC1081_DeviceConfigEncode(&cfg, regs);
+
+    if (memcmp(regs, profile->regs, MC1081_CFG_REG_NUM) == 0)
+    {
+        if (warm != NULL)
+            *warm = 1;
+        return MC1081_OK;
+    }
+
+    sta = MC1081_SoftWareReset(handle);
+    if (sta != MC1081_OK)
+        return sta;
+
+    MC1081_DeviceConfigDecode(profile->regs, &cfg);
+
+    return MC1081_DeviceConfigApply(handle, &cfg);
+}
+
+MC1081_Status_t MC1081_ProfileRestore(MC1081_Handle_t handle, const MC1081_Profile_t *profile, MC1081_Conv_t *conv,
+                                      MC1081_TempCal_t *cal, MC1081_Drift_t *drift)
+{
+    if (handle == NULL || profile == NULL)
+        return MC1081_PARAM_ERR;
+
+    MC1081_Status_t sta = MC1081_SetRefClock(handle, profile->fref_hz);
+    if (sta != MC1081_OK)
+        return sta;
+
+    if (cal != NULL)
+        *cal = profile->temp;
+
+    if (drift != NULL && (profile->flags & MC1081_PROFILE_F_ALPHA))
+        MC1081_DriftSetAlpha(drift, profile->alpha_ppm);
+
+    if (conv != NULL)
+    {
+        MC1081_ConvInit(conv, profile->fref_hz, profile->vdd_mv);
+        MC1081_ConvSetParasitic(conv, profile->cpar_ff);
+        sta = MC1081_ConvSync(handle, conv);
+    }
+
+    return sta;
+}
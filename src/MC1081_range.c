@@ -0,0 +1,189 @@
+#include "MC1081_range.h"
+
+#define MC1081_RANGE_SAT (0xFFFFU)
+
+void MC1081_RangeInit(MC1081_Range_t *range, uint16_t lanes)
+{
+    if (range == NULL)
+        return;
+
+    range->handle = NULL;
+    range->lanes = lanes;
+    range->low = MC1081_RANGE_LOW;
+    range->target = MC1081_RANGE_TARGET;
+    range->high = MC1081_RANGE_HIGH;
+    range->gain8_max = MC1081_RANGE_GAIN8_MAX;
+    range->settle = 1;
+    range->skip = 0;
+    range->retunes = 0;
+    range->overflows = 0;
+}
+
+MC1081_Status_t MC1081_RangeSetWindow(MC1081_Range_t *range, uint16_t low, uint16_t target, uint16_t high)
+{
+    if (range == NULL || low >= target || target >= high || high == MC1081_RANGE_SAT)
+        return MC1081_PARAM_ERR;
+
+    range->low = low;
+    range->target = target;
+    range->high = high;
+
+    return MC1081_OK;
+}
+
+/**
+ * @brief 按 FREFDIV 最小, FINDIV 次之的顺序寻找不超过 gain8 的最大可实现增益
+ */
+static void Solve(uint32_t gain8, MC1081_ClockCfg_t *clk, uint8_t *n)
+{
+    for (uint8_t r = MC1081_FREFDIV_1; r <= MC1081_FREFDIV_8; r++)
+    {
+        for (uint8_t f = MC1081_FINDIV_1; f <= MC1081_FINDIV_64; f++)
+        {
+            const uint32_t cnt = (gain8 << r) >> (3 + f);
+            if (cnt == 0)
+                break; // FINDIV 再大只会更小
+            if (cnt <= 255)
+            {
+                clk->fref_div = (MC1081_FrefDIV_t)r;
+                clk->fin_div = (MC1081_FinDIV_t)f;
+                *n = (uint8_t)cnt;
+                return;
+            }
+        }
+    }
+
+    // 增益低于 1/8, 取最小档
+    clk->fref_div = MC1081_FREFDIV_8;
+    clk->fin_div = MC1081_FINDIV_1;
+    *n = 1;
+}
+
+/**
+ * @brief 扫描受监视的通道, 返回最大计数值, 有溢出时返回 0xFFFF
+ */
+static uint16_t LargestCount(const MC1081_Range_t *range, const MC1081_Snapshot_t *snap, bool diff)
+{
+    const uint16_t of = diff ? (uint16_t)snap->of_diff : snap->of_single;
+    if (of & range->lanes)
+        return MC1081_RANGE_SAT;
+
+    uint16_t max = 0;
+    for (uint8_t l = 0; l < MC1081_CH_NUM + MC1081_MCH_NUM; l++)
+    {
+        if (!(range->lanes & (1U << l)))
+            continue;
+
+        const uint16_t x = (l < MC1081_CH_NUM) ? snap->ch[l] : snap->mch[l - MC1081_CH_NUM];
+        if (x > max)
+            max = x;
+    }
+
+    return max;
+}
+
+MC1081_Status_t MC1081_RangeUpdate(MC1081_Handle_t handle, MC1081_Range_t *range, const MC1081_Snapshot_t *snap, uint8_t *changed)
+{
+    if (handle == NULL || range == NULL || snap == NULL)
+        return MC1081_PARAM_ERR;
+
+    if (changed != NULL)
+        *changed = 0;
+
+    if (range->skip != 0)
+    {
+        range->skip--;
+        return MC1081_OK;
+    }
+
+    MC1081_CapConvConfig_t cap = {0};
+    MC1081_ClockCfg_t clk = {0};
+    uint8_t n = 0;
+
+    MC1081_Status_t sta = MC1081_CapMeasureGet(handle, &cap);
+    if (sta != MC1081_OK)
+        return sta;
+
+    const uint16_t max = LargestCount(range, snap, cap.osc_mode == MC1081_CAP_OSC_DIFF);
+    if (max == 0 || (max >= range->low && max <= range->high))
+        return MC1081_OK;
+
+    sta = MC1081_GetClockConfig(handle, &clk);
+    if (sta != MC1081_OK)
+        return sta;
+    sta = MC1081_GetFinCycle(handle, &n);
+    if (sta != MC1081_OK)
+        return sta;
+
+    const uint32_t gain8 = ((uint32_t)((n != 0) ? n : 1U) << (3 + clk.fin_div)) >> clk.fref_div;
+    uint64_t want = 0;
+
+    if (max == MC1081_RANGE_SAT)
+    {
+        // 溢出时真实计数未知, 每帧降 4 倍
+        range->overflows++;
+        want = gain8 / 4;
+
+        sta = MC1081_ClearOverflowFlag(handle);
+        if (sta != MC1081_OK)
+            return sta;
+    }
+    else
+    {
+        want = ((uint64_t)gain8 * range->target) / max;
+    }
+
+    if (want > range->gain8_max)
+        want = range->gain8_max;
+    if (want == 0)
+        want = 1;
+
+    MC1081_ClockCfg_t next = clk;
+    uint8_t next_n = 0;
+    Solve((uint32_t)want, &next, &next_n);
+
+    if (next.fin_div != clk.fin_div || next.fref_div != clk.fref_div)
+    {
+        sta = MC1081_SetClockConfig(handle, next);
+        if (sta != MC1081_OK)
+            return sta;
+    }
+
+    if (next_n != n)
+    {
+        sta = MC1081_SetFinCycle(handle, next_n);
+        if (sta != MC1081_OK)
+            return sta;
+    }
+
+    if (next.fin_div != clk.fin_div || next.fref_div != clk.fref_div || next_n != n)
+    {
+        range->retunes++;
+        range->skip = range->settle; // 正在进行的一帧可能跨越了新旧配置
+        if (changed != NULL)
+            *changed = 1;
+    }
+
+    return MC1081_OK;
+}
+
+bool MC1081_RangeStage(void *ctx, MC1081_Snapshot_t *snap)
+{
+    MC1081_Range_t *range = (MC1081_Range_t *)ctx;
+    const bool settling = (range->skip != 0);
+    const uint32_t overflows = range->overflows;
+
+    (void)MC1081_RangeUpdate(range->handle, range, snap, NULL);
+
+    return !settling && (range->overflows == overflows);
+}
+
+MC1081_Status_t MC1081_RangeAttach(MC1081_Handle_t handle, MC1081_Range_t *range)
+{
+    if (handle == NULL || range == NULL)
+        return MC1081_PARAM_ERR;
+
+    range->handle = handle;
+
+    return MC1081_StageAttach(handle, &range->stage, MC1081_RangeStage, range);
+}
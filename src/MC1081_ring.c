@@ -0,0 +1,107 @@
+#include "MC1081_ring.h"
+
+#define MC1081_LOAD_ACQ(p)     __atomic_load_n((p), __ATOMIC_ACQUIRE)
+#define MC1081_STORE_REL(p, v) __atomic_store_n((p), (v), __ATOMIC_RELEASE)
+
+MC1081_Status_t MC1081_RingInit(MC1081_Ring_t *ring, MC1081_Frame_t *storage, uint32_t capacity)
+{
+    if (ring == NULL || storage == NULL)
+        return MC1081_PARAM_ERR;
+
+    if (capacity == 0 || (capacity & (capacity - 1)) != 0)
+        return MC1081_PARAM_ERR;
+
+    ring->head = 0;
+    ring->tail_cache = 0;
+    ring->tail = 0;
+    ring->head_cache = 0;
+    ring->buf = storage;
+    ring->mask = capacity - 1;
+
+    return MC1081_OK;
+}
+
+MC1081_Frame_t *MC1081_RingAcquire(MC1081_Ring_t *ring)
+{
+    const uint32_t head = ring->head;
+
+    if (head - ring->tail_cache > ring->mask)
+    {
+        ring->tail_cache = MC1081_LOAD_ACQ(&ring->tail); // 本地副本显示已满时才读共享行
+        if (head - ring->tail_cache > ring->mask)
+            return NULL;
+    }
+
+    return &ring->buf[head & ring->mask];
+}
+
+void MC1081_RingCommit(MC1081_Ring_t *ring)
+{
+    MC1081_STORE_REL(&ring->head, ring->head + 1);
+}
+
+bool MC1081_RingPush(MC1081_Ring_t *ring, const MC1081_Frame_t *frame)
+{
+    MC1081_Frame_t *slot = MC1081_RingAcquire(ring);
+    if (slot == NULL)
+        return false;
+
+    *slot = *frame;
+    MC1081_RingCommit(ring);
+    return true;
+}
+
+const MC1081_Frame_t *MC1081_RingPeek(MC1081_Ring_t *ring)
+{
+    const uint32_t tail = ring->tail;
+
+    if (tail == ring->head_cache)
+    {
+        ring->head_cache = MC1081_LOAD_ACQ(&ring->head);
+        if (tail == ring->head_cache)
+            return NULL;
+    }
+
+    return &ring->buf[tail & ring->mask];
+}
+
+void MC1081_RingRelease(MC1081_Ring_t *ring)
+{
+    MC1081_STORE_REL(&ring->tail, ring->tail + 1);
+}
+
+bool MC1081_RingPop(MC1081_Ring_t *ring, MC1081_Frame_t *frame)
+{
+    const MC1081_Frame_t *slot = MC1081_RingPeek(ring);
+    if (slot == NULL)
+        return false;
+
+    *frame = *slot;
+    MC1081_RingRelease(ring);
+    return true;
+}
+
+uint32_t MC1081_RingCount(const MC1081_Ring_t *ring)
+{
+    return MC1081_LOAD_ACQ(&ring->head) - MC1081_LOAD_ACQ(&ring->tail);
+}
+
+MC1081_Status_t MC1081_AcquireToRing(MC1081_Handle_t handle, MC1081_Ring_t *ring, uint64_t timestamp)
+{
+    if (handle == NULL || ring == NULL)
+        return MC1081_PARAM_ERR;
+
+    MC1081_Frame_t *slot = MC1081_RingAcquire(ring);
+    if (slot == NULL)
+        return MC1081_FULL_ERR;
+
+    MC1081_Status_t sta = MC1081_ReadSnapshot(handle, &slot->data);
+    if (sta != MC1081_OK)
+        return sta; // 未提交, 该槽位下次继续使用
+
+    slot->timestamp = timestamp;
+    (void)MC1081_LastFrameTime(handle, &slot->time);
+    MC1081_RingCommit(ring);
+
+    return MC1081_OK;
+}
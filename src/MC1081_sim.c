@@ -0,0 +1,633 @@
+#include "MC1081_sim.h"
+#include "MC1081_reg.h"
+#include "string.h"
+#include "math.h"
+
+#ifdef __linux__
+#include "errno.h"
+#include "linux/i2c.h"
+#endif
+
+#define MC1081_SIM_REG_RESET (0x69)
+#define MC1081_SIM_RESET_KEY (0x7A)
+#define MC1081_SIM_REG_NUM   (sizeof(((MC1081_Sim_t *)0)->regs))
+
+static MC1081_SimBus_t *s_legacy_bus = NULL;
+
+/* 振荡器驱动电流, uA, 对应 MC1081_DriverCu_t */
+static const double s_osc_ua[] = {4, 8, 16, 42, 100, 250, 500, 1000, 2000};
+
+/* OS1 振幅, V; 后四档按 VDD - x 计算, x 为负数表示 */
+static const double s_os1_v[] = {0.2, 0.4, 0.8, 1.2, -2.2, -1.6, -1.2, -0.8};
+
+/* OS2 振幅, V */
+static const double s_os2_v[] = {0.2, 0.4, 0.8, 1.2, 1.6, 2.0, 2.4, 2.4};
+
+/* 周期测量间隔, ns, 对应 MC1081_CapTime_t, 连续模式为 0 */
+static const uint64_t s_interval_ns[] = {10000000000ULL, 1000000000ULL, 100000000ULL, 0};
+
+static const uint8_t s_avg_cycles[] = {1, 4, 8, 32};
+
+static uint32_t SimRand(MC1081_Sim_t *sim)
+{
+    uint32_t x = sim->seed;
+    x ^= x << 13;
+    x ^= x >> 17;
+    x ^= x << 5;
+    sim->seed = x;
+    return x;
+}
+
+static double WaveSample(MC1081_Sim_t *sim, const MC1081_SimWave_t *wave, uint64_t t_ns)
+{
+    double v = wave->base;
+
+    if (wave->period_us != 0)
+    {
+        const uint64_t period_ns = (uint64_t)wave->period_us * 1000ULL;
+        const double phase = (double)(t_ns % period_ns) / (double)period_ns;
+
+        switch (wave->type)
+        {
+        case MC1081_SIM_WAVE_SINE:
+            v += wave->amp * sin(2.0 * 3.14159265358979323846 * phase);
+            break;
+        case MC1081_SIM_WAVE_SQUARE:
+            v += (phase < 0.5) ? wave->amp : 0;
+            break;
+        case MC1081_SIM_WAVE_TRIANGLE:
+            v += wave->amp * ((phase < 0.5) ? (2.0 * phase) : (2.0 - 2.0 * phase));
+            break;
+        default:
+            break;
+        }
+    }
+
+    if (wave->noise != 0)
+    {
+        v += (double)(int32_t)(SimRand(sim) % (2U * wave->noise + 1U)) - (double)wave->noise;
+    }
+
+    return v;
+}
+
+static bool IsDiffMode(const MC1081_Sim_t *sim)
+{
+    MC1081_C_CMD_t c_cmd = {0};
+    c_cmd.byte = sim->regs[MC1081_REG_C_CMD];
+    return c_cmd.bits.OSC_SEL == MC1081_CAP_OSC_DIFF;
+}
+
+/**
+ * @brief 计算电容 c_ff 对应的振荡频率 f_in
+ */
+static double FinHz(const MC1081_Sim_t *sim, double c_ff)
+{
+    uint8_t cu = 0;
+    double v = 0;
+
+    if (IsDiffMode(sim))
+    {
+        MC1081_OSC2_CFG_t cfg = {0};
+        cfg.byte = sim->regs[MC1081_REG_OSC2_CFG];
+        cu = cfg.bits.OSC2_I;
+        v = s_os2_v[cfg.bits.OSC2_V];
+    }
+    else
+    {
+        MC1081_OSC1_CFG_t cfg = {0};
+        cfg.byte = sim->regs[MC1081_REG_OSC1_CFG];
+        cu = cfg.bits.OSC1_I;
+        v = s_os1_v[cfg.bits.OSC1_V];
+        if (v < 0)
+            v += sim->vdd_mv / 1000.0;
+    }
+
+    if (cu >= sizeof(s_osc_ua) / sizeof(s_osc_ua[0]))
+        cu = sizeof(s_osc_ua) / sizeof(s_osc_ua[0]) - 1;
+
+    double c = (c_ff + sim->cpar_ff) * 1e-15;
+    if (c < 1e-15)
+        c = 1e-15;
+
+    return (s_osc_ua[cu] * 1e-6) / (2.0 * c * v);
+}
+
+static uint32_t FinCycles(const MC1081_Sim_t *sim)
+{
+    MC1081_DIV_CFG_t div = {0};
+    div.byte = sim->regs[MC1081_REG_DIV_CFG];
+
+    uint32_t n = sim->regs[MC1081_REG_FIN_CNT];
+    if (n == 0)
+        n = 1;
+
+    return n << div.bits.FINDIV;
+}
+
+static double ChannelCapFf(MC1081_Sim_t *sim, const MC1081_SimWave_t *wave, uint64_t t_ns)
+{
+    double c = WaveSample(sim, wave, t_ns);
+    const double t_c = WaveSample(sim, &sim->temp, t_ns) / 1000.0;
+
+    return c * (1.0 + sim->drift_ppm * 1e-6 * (t_c - 25.0));
+}
+
+/**
+ * @brief 遍历当前使能的通道; 回调参数为数据字下标、溢出位与波形
+ */
+typedef void (*SimChFunc_t)(MC1081_Sim_t *sim, uint8_t word, uint8_t of_bit, const MC1081_SimWave_t *wave, void *arg);
+
+static void ForEachChannel(MC1081_Sim_t *sim, SimChFunc_t fn, void *arg)
+{
+    if (IsDiffMode(sim))
+    {
+        MC1081_OSC2_DCHS_t dchs = {0};
+        dchs.byte = sim->regs[MC1081_REG_OSC2_DCHS];
+        for (uint8_t i = 0; i <= MC1081_DCH_DIFF_REF; i++)
+        {
+            if (dchs.byte & (1U << i))
+                fn(sim, i, i, &sim->ch[i], arg);
+        }
+        return;
+    }
+
+    const uint16_t chs = (uint16_t)(sim->regs[MC1081_REG_OSC1_CHS] | (sim->regs[MC1081_REG_OSC1_CHS + 1] << 8));
+    for (uint8_t i = 0; i < MC1081_CH_NUM; i++)
+    {
+        if (chs & (1U << i))
+            fn(sim, i, i, &sim->ch[i], arg);
+    }
+
+    const uint8_t mchs = sim->regs[MC1081_REG_OSC1_MCHS];
+    for (uint8_t i = 0; i < MC1081_MCH_NUM; i++)
+    {
+        if (mchs & (1U << i))
+            fn(sim, (uint8_t)(2 * i + 1), (uint8_t)(MC1081_CH_NUM + i), &sim->mch[i], arg);
+    }
+}
+
+typedef struct
+{
+    uint64_t t_ns;
+    double total_s;
+} SimTimeArg_t;
+
+static void AccumulateTime(MC1081_Sim_t *sim, uint8_t word, uint8_t of_bit, const MC1081_SimWave_t *wave, void *arg)
+{
+    (void)word;
+    (void)of_bit;
+
+    SimTimeArg_t *t = (SimTimeArg_t *)arg;
+    MC1081_DIV_CFG_t div = {0};
+    div.byte = sim->regs[MC1081_REG_DIV_CFG];
+
+    /* 计时只用无噪声的波形, 避免扰动噪声序列 */
+    MC1081_SimWave_t clean = *wave;
+    clean.noise = 0;
+    const uint32_t seed = sim->seed;
+    const double c = ChannelCapFf(sim, &clean, t->t_ns);
+    sim->seed = seed;
+
+    const double settle = div.bits.SETTLING ? 4.0 : 1.0;
+    t->total_s += (settle + FinCycles(sim)) / FinHz(sim, c);
+}
+
+static uint64_t FrameTimeAt(MC1081_Sim_t *sim, uint64_t t_ns)
+{
+    MC1081_C_CMD_t c_cmd = {0};
+    c_cmd.byte = sim->regs[MC1081_REG_C_CMD];
+
+    SimTimeArg_t arg = {t_ns, 0.0};
+    ForEachChannel(sim, AccumulateTime, &arg);
+
+    return (uint64_t)(arg.total_s * s_avg_cycles[c_cmd.bits.CAVG] * 1e9);
+}
+
+uint64_t MC1081_SimFrameTimeNs(const MC1081_Sim_t *sim)
+{
+    MC1081_Sim_t tmp = *sim;
+    return FrameTimeAt(&tmp, sim->cap_start_ns);
+}
+
+static void StoreCount(MC1081_Sim_t *sim, uint8_t word, uint8_t of_bit, const MC1081_SimWave_t *wave, void *arg)
+{
+    const uint64_t t_ns = *(const uint64_t *)arg;
+
+    MC1081_C_CMD_t c_cmd = {0};
+    c_cmd.byte = sim->regs[MC1081_REG_C_CMD];
+    MC1081_DIV_CFG_t div = {0};
+    div.byte = sim->regs[MC1081_REG_DIV_CFG];
+
+    const uint8_t avg = s_avg_cycles[c_cmd.bits.CAVG];
+    const double fref = (double)sim->fref_hz / (double)(1U << div.bits.FREFDIV);
+
+    double count = 0;
+    for (uint8_t i = 0; i < avg; i++)
+    {
+        count += FinCycles(sim) * fref / FinHz(sim, ChannelCapFf(sim, wave, t_ns));
+    }
+    count /= avg;
+
+    uint16_t value = 0;
+    if (count > 65535.0)
+    {
+        value = 0xFFFF;
+        if (IsDiffMode(sim))
+            sim->regs[MC1081_REG_OSC2] |= (uint8_t)(1U << of_bit);
+        else
+            sim->regs[MC1081_REG_OSC1 + of_bit / 8] |= (uint8_t)(1U << (of_bit % 8));
+    }
+    else
+    {
+        value = (uint16_t)(count + 0.5);
+    }
+
+    sim->regs[MC1081_REG_CHDATA + 2 * word] = (uint8_t)(value >> 8);
+    sim->regs[MC1081_REG_CHDATA + 2 * word + 1] = (uint8_t)(value & 0xFF);
+}
+
+static void StartTemp(MC1081_Sim_t *sim, uint64_t t_ns)
+{
+    MC1081_T_CMD_t t_cmd = {0};
+    t_cmd.byte = sim->regs[MC1081_REG_T_CMD];
+
+    if (!t_cmd.bits.STC || sim->temp_run)
+        return;
+
+    sim->temp_run = 1;
+    sim->temp_done_ns = t_ns + (t_cmd.bits.TCV == MC1081_TEMP_TIME_0P3_MS ? 300000ULL : 1700000ULL);
+    sim->regs[MC1081_REG_STATUS] |= 0x02;
+}
+
+static void CompleteTemp(MC1081_Sim_t *sim)
+{
+    const double t_c = WaveSample(sim, &sim->temp, sim->temp_done_ns) / 1000.0;
+    const int16_t raw = (int16_t)lround((t_c - 40.0) * 256.0);
+
+    MC1081_TDATA_Reg_t tdata = {0};
+    tdata.bytes = (uint16_t)raw;
+    sim->regs[MC1081_REG_TDATA] = (uint8_t)(tdata.bytes & 0xFF);
+    sim->regs[MC1081_REG_TDATA + 1] = (uint8_t)(tdata.bytes >> 8);
+
+    sim->temp_run = 0;
+    sim->regs[MC1081_REG_STATUS] &= (uint8_t)~0x02;
+}
+
+static void StartFrame(MC1081_Sim_t *sim, uint64_t t_ns)
+{
+    sim->cap_start_ns = t_ns;
+    sim->cap_done_ns = t_ns + FrameTimeAt(sim, t_ns);
+    StartTemp(sim, t_ns);
+}
+
+/**
+ * @brief 按时间顺序推进转换过程到 now_ns
+ */
+static void SimUpdate(MC1081_Sim_t *sim, uint64_t now_ns)
+{
+    MC1081_C_CMD_t c_cmd = {0};
+    c_cmd.byte = sim->regs[MC1081_REG_C_CMD];
+
+    while (sim->cap_run && sim->cap_done_ns <= now_ns)
+    {
+        if (sim->temp_run && sim->temp_done_ns <= sim->cap_done_ns)
+            CompleteTemp(sim);
+
+        uint64_t t_done = sim->cap_done_ns;
+        ForEachChannel(sim, StoreCount, &t_done);
+        sim->frames++;
+
+        if (c_cmd.bits.OS != MC1081_CAP_START_PERIODIC)
+        {
+            sim->cap_run = 0;
+            sim->regs[MC1081_REG_STATUS] &= (uint8_t)~0x01;
+            if (c_cmd.bits.OS == MC1081_CAP_START_SINGLE) // 单次转换结束, OS 回到停止
+            {
+                c_cmd.bits.OS = MC1081_CAP_START_STOP;
+                sim->regs[MC1081_REG_C_CMD] = c_cmd.byte;
+            }
+            break;
+        }
+
+        uint64_t period = s_interval_ns[c_cmd.bits.CR];
+        uint64_t frame = sim->cap_done_ns - sim->cap_start_ns;
+        if (frame == 0)
+            frame = 1000;
+        if (period < frame)
+            period = frame;
+
+        uint64_t next = sim->cap_start_ns + period;
+        if (now_ns > next + 2 * period)
+        {
+            next += ((now_ns - next) / period - 1) * period; // 跳过长时间空闲中不会被读到的帧
+        }
+        StartFrame(sim, next);
+        if (sim->cap_done_ns == next)
+            sim->cap_done_ns = next + frame;
+    }
+
+    if (sim->temp_run && sim->temp_done_ns <= now_ns)
+        CompleteTemp(sim);
+}
+
+static void SimReset(MC1081_Sim_t *sim)
+{
+    memset(sim->regs, 0, sizeof(sim->regs));
+
+    MC1081_C_CMD_t c_cmd = {0};
+    c_cmd.bits.OS = MC1081_CAP_START_STOP;
+    sim->regs[MC1081_REG_C_CMD] = c_cmd.byte;
+    sim->regs[MC1081_REG_FIN_CNT] = 0xFE;
+
+    sim->cap_run = 0;
+    sim->temp_run = 0;
+}
+
+static void WriteRegister(MC1081_Sim_t *sim, uint8_t reg, uint8_t value, uint64_t now_ns)
+{
+    if (reg == MC1081_SIM_REG_RESET)
+    {
+        if (value == MC1081_SIM_RESET_KEY)
+            SimReset(sim);
+        return;
+    }
+
+    if (reg == MC1081_REG_STATUS)
+    {
+        MC1081_STATUSReg_t status = {0};
+        status.byte = value;
+        if (status.bits.OF_CLEAR)
+        {
+            sim->regs[MC1081_REG_OSC1] = 0;
+            sim->regs[MC1081_REG_OSC1 + 1] = 0;
+            sim->regs[MC1081_REG_OSC2] = 0;
+        }
+        return;
+    }
+
+    if (reg < MC1081_REG_T_CMD || reg >= MC1081_SIM_REG_NUM)
+        return;
+
+    sim->regs[reg] = value;
+
+    if (reg == MC1081_REG_T_CMD)
+    {
+        StartTemp(sim, now_ns);
+    }
+    else if (reg == MC1081_REG_C_CMD)
+    {
+        MC1081_C_CMD_t c_cmd = {0};
+        c_cmd.byte = value;
+
+        if (c_cmd.bits.OS == MC1081_CAP_START_PERIODIC || c_cmd.bits.OS == MC1081_CAP_START_SINGLE)
+        {
+            sim->cap_run = 1;
+            sim->regs[MC1081_REG_STATUS] |= 0x01;
+            StartFrame(sim, now_ns);
+        }
+        else
+        {
+            sim->cap_run = 0;
+            sim->regs[MC1081_REG_STATUS] &= (uint8_t)~0x01;
+        }
+    }
+}
+
+static MC1081_Sim_t *FindDevice(MC1081_SimBus_t *bus, uint8_t addr)
+{
+    for (uint8_t i = 0; i < bus->num; i++)
+    {
+        if (bus->dev[i]->addr == addr)
+            return bus->dev[i];
+    }
+    return NULL;
+}
+
+/**
+ * @brief 按 SCL 速率推进总线时间: 地址字节 + 数据字节, 每字节 9 个时钟, 加起始/停止
+ */
+static void BusTransfer(MC1081_SimBus_t *bus, size_t len)
+{
+    if (bus->scl_hz == 0)
+        return;
+
+    const uint64_t clocks = (uint64_t)(len + 1) * 9ULL + 2ULL;
+    bus->now_ns += (clocks * 1000000000ULL) / bus->scl_hz;
+}
+
+/**
+ * @brief 故障注入: 返回本次传输应失败的总线码, 0 为正常; 超时故障在截止时间前结束时按延长后的时间正常完成
+ */
+static int BusFault(MC1081_SimBus_t *bus)
+{
+    bus->xfers++;
+    if (bus->fault_every == 0 || (bus->xfers % bus->fault_every) != 0)
+        return MC1081_BUS_OK;
+
+    if (bus->fault != MC1081_BUS_TIMEOUT)
+        return bus->fault;
+
+    const uint64_t end = bus->now_ns + (uint64_t)bus->stall_us * 1000ULL;
+    if (bus->deadline_ns != 0 && end > bus->deadline_ns)
+    {
+        // 主机在截止时间放弃传输
+        if (bus->now_ns < bus->deadline_ns)
+            bus->now_ns = bus->deadline_ns;
+        return MC1081_BUS_TIMEOUT;
+    }
+
+    bus->now_ns = end;
+    return MC1081_BUS_OK;
+}
+
+void MC1081_SimInit(MC1081_Sim_t *sim, uint8_t addr)
+{
+    if (sim == NULL)
+        return;
+
+    memset(sim, 0, sizeof(MC1081_Sim_t));
+    sim->addr = addr;
+    sim->fref_hz = MC1081_SIM_FREF_HZ;
+    sim->vdd_mv = 3300;
+    sim->seed = 0x1081U + addr;
+    sim->temp.base = 25000;
+
+    for (uint8_t i = 0; i < MC1081_CH_NUM; i++)
+        sim->ch[i].base = 10000;
+    for (uint8_t i = 0; i < MC1081_MCH_NUM; i++)
+        sim->mch[i].base = 10000;
+
+    SimReset(sim);
+}
+
+void MC1081_SimBusInit(MC1081_SimBus_t *bus, uint32_t scl_hz)
+{
+    if (bus == NULL)
+        return;
+
+    memset(bus, 0, sizeof(MC1081_SimBus_t));
+    bus->scl_hz = scl_hz;
+}
+
+MC1081_Status_t MC1081_SimBusAttach(MC1081_SimBus_t *bus, MC1081_Sim_t *sim)
+{
+    if (bus == NULL || sim == NULL)
+        return MC1081_PARAM_ERR;
+
+    if (bus->num >= MC1081_SIM_BUS_MAX_DEV || FindDevice(bus, sim->addr) != NULL)
+        return MC1081_PARAM_ERR;
+
+    bus->dev[bus->num++] = sim;
+    return MC1081_OK;
+}
+
+void MC1081_SimBusInterface(MC1081_SimBus_t *bus, MC1081_Bus_t *out)
+{
+    if (out == NULL)
+        return;
+
+    out->ctx = bus;
+    out->Write = MC1081_SimBusWrite;
+    out->Read = MC1081_SimBusRead;
+    out->Delay = MC1081_SimBusDelay;
+    out->Deadline = MC1081_SimBusDeadline;
+    out->ReadRegs = NULL; // 模型按写 + 读处理寄存器读
+}
+
+void MC1081_SimBusAdvance(MC1081_SimBus_t *bus, uint64_t ns)
+{
+    if (bus == NULL)
+        return;
+
+    bus->now_ns += ns;
+}
+
+int MC1081_SimBusWrite(void *ctx, uint8_t addr, const uint8_t *data, size_t len)
+{
+    MC1081_SimBus_t *bus = (MC1081_SimBus_t *)ctx;
+    MC1081_Sim_t *sim = FindDevice(bus, addr);
+
+    if (sim == NULL)
+    {
+        BusTransfer(bus, 0);
+        return MC1081_BUS_ADDR_NACK;
+    }
+
+    const int fault = BusFault(bus);
+    if (fault == MC1081_BUS_ADDR_NACK || fault == MC1081_BUS_TIMEOUT)
+    {
+        if (fault == MC1081_BUS_ADDR_NACK)
+            BusTransfer(bus, 0);
+        return fault;
+    }
+
+    BusTransfer(bus, len);
+    SimUpdate(sim, bus->now_ns);
+
+    if (len == 0)
+        return 0;
+
+    sim->ptr = data[0];
+    if (fault != MC1081_BUS_OK)
+        return fault; // 指针已收下, 数据字节未应答
+
+    for (size_t i = 1; i < len; i++)
+    {
+        WriteRegister(sim, sim->ptr++, data[i], bus->now_ns);
+    }
+
+    return 0;
+}
+
+int MC1081_SimBusRead(void *ctx, uint8_t addr, uint8_t *dst, size_t len)
+{
+    MC1081_SimBus_t *bus = (MC1081_SimBus_t *)ctx;
+    MC1081_Sim_t *sim = FindDevice(bus, addr);
+
+    if (sim == NULL)
+    {
+        BusTransfer(bus, 0);
+        return MC1081_BUS_ADDR_NACK;
+    }
+
+    const int fault = BusFault(bus);
+    if (fault == MC1081_BUS_ADDR_NACK || fault == MC1081_BUS_TIMEOUT)
+    {
+        if (fault == MC1081_BUS_ADDR_NACK)
+            BusTransfer(bus, 0);
+        return fault;
+    }
+
+    BusTransfer(bus, len);
+    SimUpdate(sim, bus->now_ns);
+
+    for (size_t i = 0; i < len; i++, sim->ptr++)
+    {
+        dst[i] = (sim->ptr < MC1081_SIM_REG_NUM) ? sim->regs[sim->ptr] : 0x00;
+    }
+
+    return fault; // 数据 NACK 时字节已移出, 指针照常递增
+}
+
+void MC1081_SimBusDelay(void *ctx, uint32_t us)
+{
+    MC1081_SimBusAdvance((MC1081_SimBus_t *)ctx, (uint64_t)us * 1000ULL);
+}
+
+void MC1081_SimBusDeadline(void *ctx, uint64_t deadline_ns)
+{
+    ((MC1081_SimBus_t *)ctx)->deadline_ns = deadline_ns;
+}
+
+uint64_t MC1081_SimBusClock(void *ctx)
+{
+    return ((const MC1081_SimBus_t *)ctx)->now_ns;
+}
+
+void MC1081_SimSetLegacyBus(MC1081_SimBus_t *bus)
+{
+    s_legacy_bus = bus;
+}
+
+int MC1081_SimTransmit(const uint8_t *data, const size_t len)
+{
+    if (s_legacy_bus == NULL || s_legacy_bus->num == 0)
+        return -1;
+
+    return MC1081_SimBusWrite(s_legacy_bus, s_legacy_bus->dev[0]->addr, data, len);
+}
+
+int MC1081_SimReceive(const uint8_t *dst, const size_t len)
+{
+    if (s_legacy_bus == NULL || s_legacy_bus->num == 0)
+        return -1;
+
+    return MC1081_SimBusRead(s_legacy_bus, s_legacy_bus->dev[0]->addr, (uint8_t *)dst, len);
+}
+
+#ifdef __linux__
+
+int MC1081_SimLinuxXfer(void *ctx, struct i2c_msg *msgs, uint32_t num)
+{
+    for (uint32_t i = 0; i < num; i++)
+    {
+        const int ret = (msgs[i].flags & I2C_M_RD)
+                            ? MC1081_SimBusRead(ctx, (uint8_t)msgs[i].addr, msgs[i].buf, msgs[i].len)
+                            : MC1081_SimBusWrite(ctx, (uint8_t)msgs[i].addr, msgs[i].buf, msgs[i].len);
+
+        // 与内核一致, 以负 errno 报告
+        if (ret == MC1081_BUS_ADDR_NACK)
+            return -ENXIO;
+        if (ret == MC1081_BUS_DATA_NACK)
+            return -EREMOTEIO;
+        if (ret == MC1081_BUS_TIMEOUT)
+            return -ETIMEDOUT;
+        if (ret != 0)
+            return -EIO;
+    }
+
+    return 0;
+}
+
+#endif
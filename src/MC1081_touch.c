@@ -0,0 +1,215 @@
+#include "MC1081_touch.h"
+#include "string.h"
+
+#define MC1081_TOUCH_SAT (0xFFFFU)
+
+void MC1081_TouchInit(MC1081_Touch_t *touch, MC1081_TouchEventFunc_t event, void *user)
+{
+    if (touch == NULL)
+        return;
+
+    memset(touch, 0, sizeof(MC1081_Touch_t));
+    touch->event = event;
+    touch->user = user;
+    touch->base_shift = MC1081_TOUCH_BASE_SHIFT;
+    touch->neg_shift = MC1081_TOUCH_NEG_SHIFT;
+}
+
+MC1081_Status_t MC1081_TouchSetLanes(MC1081_Touch_t *touch, uint16_t lanes, const MC1081_TouchCfg_t *cfg)
+{
+    if (touch == NULL || cfg == NULL)
+        return MC1081_PARAM_ERR;
+
+    if (cfg->prox_th == 0 || cfg->touch_th < cfg->prox_th || cfg->hyst >= cfg->prox_th)
+        return MC1081_PARAM_ERR;
+
+    for (uint8_t l = 0; l < MC1081_TOUCH_LANES; l++)
+    {
+        const uint16_t bit = (uint16_t)(1U << l);
+        if (!(lanes & bit))
+            continue;
+
+        touch->prox_th[l] = cfg->prox_th;
+        touch->touch_th[l] = cfg->touch_th;
+        touch->hyst[l] = cfg->hyst;
+        touch->debounce_on[l] = (cfg->debounce_on != 0) ? cfg->debounce_on : 1;
+        touch->debounce_off[l] = (cfg->debounce_off != 0) ? cfg->debounce_off : 1;
+        touch->max_on[l] = cfg->max_on;
+
+        if (cfg->invert)
+            touch->invert |= bit;
+        else
+            touch->invert &= (uint16_t)~bit;
+    }
+
+    touch->enabled |= lanes;
+    MC1081_TouchRecalibrate(touch, lanes);
+
+    return MC1081_OK;
+}
+
+void MC1081_TouchDisableLanes(MC1081_Touch_t *touch, uint16_t lanes)
+{
+    touch->enabled &= (uint16_t)~lanes;
+    MC1081_TouchRecalibrate(touch, lanes);
+}
+
+MC1081_Status_t MC1081_TouchSetBaselineRate(MC1081_Touch_t *touch, uint8_t base_shift, uint8_t neg_shift)
+{
+    if (touch == NULL || base_shift == 0 || base_shift > 15 || neg_shift == 0 || neg_shift > 15)
+        return MC1081_PARAM_ERR;
+
+    touch->base_shift = base_shift;
+    touch->neg_shift = neg_shift;
+
+    return MC1081_OK;
+}
+
+void MC1081_TouchRecalibrate(MC1081_Touch_t *touch, uint16_t lanes)
+{
+    touch->primed &= (uint16_t)~lanes;
+    touch->prox &= (uint16_t)~lanes;
+    touch->touch &= (uint16_t)~lanes;
+
+    for (uint8_t l = 0; l < MC1081_TOUCH_LANES; l++)
+    {
+        if (!(lanes & (1U << l)))
+            continue;
+
+        touch->level[l] = MC1081_TOUCH_IDLE;
+        touch->deb_cnt[l] = 0;
+        touch->on_cnt[l] = 0;
+        touch->delta[l] = 0;
+    }
+}
+
+uint16_t MC1081_TouchBaseline(const MC1081_Touch_t *touch, uint8_t lane)
+{
+    if (lane >= MC1081_TOUCH_LANES)
+        return 0;
+
+    return (uint16_t)((touch->base_q16[lane] + 0x8000U) >> 16);
+}
+
+/**
+ * @brief 从 from 级逐级切换到 to 级, 每跨一级上报一个事件
+ */
+static void Move(MC1081_Touch_t *touch, uint8_t l, uint8_t from, uint8_t to, int32_t delta)
+{
+    const uint16_t bit = (uint16_t)(1U << l);
+
+    while (from != to)
+    {
+        MC1081_TouchEvent_t ev;
+
+        if (to > from)
+            ev = (from++ == MC1081_TOUCH_IDLE) ? MC1081_TOUCH_EV_PROX : MC1081_TOUCH_EV_TOUCH;
+        else
+            ev = (from-- == MC1081_TOUCH_TOUCH) ? MC1081_TOUCH_EV_RELEASE : MC1081_TOUCH_EV_PROX_LEAVE;
+
+        if (touch->event != NULL)
+            touch->event(touch->user, l, ev, delta);
+    }
+
+    touch->level[l] = to;
+    touch->deb_cnt[l] = 0;
+
+    if (to >= MC1081_TOUCH_PROX)
+        touch->prox |= bit;
+    else
+        touch->prox &= (uint16_t)~bit;
+
+    if (to == MC1081_TOUCH_TOUCH)
+        touch->touch |= bit;
+    else
+        touch->touch &= (uint16_t)~bit;
+}
+
+static void Lane(MC1081_Touch_t *touch, uint8_t l, uint16_t x)
+{
+    const uint16_t bit = (uint16_t)(1U << l);
+
+    if (!(touch->primed & bit))
+    {
+        touch->base_q16[l] = (uint32_t)x << 16;
+        touch->primed |= bit;
+    }
+
+    const uint32_t xq = (uint32_t)x << 16;
+    uint32_t base = touch->base_q16[l];
+    int32_t d = (int32_t)x - (int32_t)((base + 0x8000U) >> 16);
+    if (touch->invert & bit)
+        d = -d;
+    touch->delta[l] = d;
+
+    // 当前级别决定使用阈值还是阈值减回差
+    const uint8_t cur = touch->level[l];
+    uint8_t target = MC1081_TOUCH_IDLE;
+    if (d >= (int32_t)touch->prox_th[l] - ((cur >= MC1081_TOUCH_PROX) ? (int32_t)touch->hyst[l] : 0))
+        target = MC1081_TOUCH_PROX;
+    if (d >= (int32_t)touch->touch_th[l] - ((cur == MC1081_TOUCH_TOUCH) ? (int32_t)touch->hyst[l] : 0))
+        target = MC1081_TOUCH_TOUCH;
+
+    if (target == cur)
+    {
+        touch->deb_cnt[l] = 0;
+    }
+    else
+    {
+        const uint8_t need = (target > cur) ? touch->debounce_on[l] : touch->debounce_off[l];
+        if (++touch->deb_cnt[l] >= need)
+        {
+            Move(touch, l, cur, target, d);
+            if (target == MC1081_TOUCH_IDLE)
+                touch->on_cnt[l] = 0;
+        }
+    }
+
+    if (touch->level[l] != MC1081_TOUCH_IDLE)
+    {
+        // 长时间有效视为卡键, 以当前值重新建立基线
+        if (touch->max_on[l] != 0 && ++touch->on_cnt[l] >= touch->max_on[l])
+        {
+            Move(touch, l, touch->level[l], MC1081_TOUCH_IDLE, d);
+            touch->on_cnt[l] = 0;
+            touch->base_q16[l] = xq;
+        }
+        return; // 有效期间基线冻结
+    }
+
+    if (touch->deb_cnt[l] != 0)
+        return; // 上升待确认, 基线不跟随
+
+    // 低于基线时用更快的速率回落
+    const uint8_t k = (d < 0) ? touch->neg_shift : touch->base_shift;
+    base = (xq >= base) ? (base + ((xq - base) >> k)) : (base - ((base - xq) >> k));
+    touch->base_q16[l] = base;
+}
+
+bool MC1081_TouchStage(void *ctx, MC1081_Snapshot_t *snap)
+{
+    MC1081_Touch_t *touch = (MC1081_Touch_t *)ctx;
+    const uint16_t enabled = touch->enabled;
+
+    for (uint8_t l = 0; l < MC1081_TOUCH_LANES; l++)
+    {
+        if (!(enabled & (1U << l)))
+            continue;
+
+        const uint16_t x = (l < MC1081_CH_NUM) ? snap->ch[l] : snap->mch[l - MC1081_CH_NUM];
+        if (x == MC1081_TOUCH_SAT)
+            continue; // 溢出值不参与判断
+
+        Lane(touch, l, x);
+    }
+
+    return true;
+}
+
+MC1081_Status_t MC1081_TouchAttach(MC1081_Handle_t handle, MC1081_Touch_t *touch)
+{
+    if (handle == NULL || touch == NULL)
+        return MC1081_PARAM_ERR;
+
+    return MC1081_StageAttach(handle, &touch->stage, MC1081_TouchStage, touch);
+}